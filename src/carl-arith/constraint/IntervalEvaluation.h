@@ -4,6 +4,7 @@
 #include "BasicConstraint.h"
 #include <carl-arith/interval/Interval.h>
 #include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/AdaptiveIntervalEvaluation.h>
 #include <boost/logic/tribool_io.hpp>
 
 namespace carl {
@@ -13,6 +14,15 @@ inline boost::tribool evaluate(const BasicConstraint<Poly>& c, const Assignment<
 	return evaluate(evaluate(c.lhs(), map), c.relation());
 }
 
+/**
+ * Evaluates the constraint on the given intervals, using floating point arithmetic where it suffices.
+ * @see evaluate_adaptive(const MultivariatePolynomial<Coeff, Policy, Ordering>&, const std::map<Variable, Interval<Number>>&, Relation, const AdaptiveEvaluationSettings&, AdaptivePrecision*)
+ */
+template<typename Number, typename Poly>
+inline boost::tribool evaluate_adaptive(const BasicConstraint<Poly>& c, const Assignment<Interval<Number>>& map, const AdaptiveEvaluationSettings& settings = AdaptiveEvaluationSettings(), AdaptivePrecision* used = nullptr) {
+	return evaluate_adaptive(c.lhs(), map, c.relation(), settings, used);
+}
+
 /**
  * Checks whether this constraint is consistent with the given assignment from 
  * the its variables to interval domains.
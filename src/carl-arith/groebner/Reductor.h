@@ -9,6 +9,7 @@
 
 #include "Ideal.h"
 #include "ReductorEntry.h"
+#include <carl-arith/poly/umvpoly/Geobucket.h>
 #include <carl-common/datastructures/Heap.h>
 #include <carl-common/datastructures/BitVector.h>
 
@@ -24,6 +25,7 @@ class ReductorConfiguration
 {
 public:
 
+	using PolynomialType = Polynomial;
 	using EntryType = ReductorEntry<Polynomial>;
 	using Entry = EntryType*;
 	using CompareResult = carl::CompareResult;
@@ -60,6 +62,24 @@ public:
 	static const bool fastIndex = true;
 };
 
+/**
+ * @ingroup gb
+ * A Datastructure for the Reductor that accumulates the partial reductions in a Geobucket.
+ * Instead of keeping a heap of scaled polynomials, the scaled tails of the reductors are merged into the geobucket
+ * and coefficients of equal monomials are combined in place.
+ */
+template<class Configuration>
+class GeobucketReduction : public Geobucket<typename Configuration::PolynomialType>
+{
+public:
+	explicit GeobucketReduction(const Configuration& /*unused*/) {}
+};
+
+template<class Datastructure>
+struct is_geobucket_reduction: std::false_type {};
+template<class Configuration>
+struct is_geobucket_reduction<GeobucketReduction<Configuration>>: std::true_type {};
+
 /**
  * A dedicated algorithm for calculating the remainder of a polynomial modulo a set of other polynomials. 
  * @ingroup gb
@@ -72,6 +92,7 @@ protected:
 	using Order = typename InputPolynomial::OrderedBy;
 	using EntryType = typename Configuration<InputPolynomial>::EntryType;
 	using Coeff = typename InputPolynomial::CoeffType;
+	static constexpr bool accumulating = is_geobucket_reduction<Datastructure<Configuration<InputPolynomial>>>::value;
 private:
 	const Ideal<PolynomialInIdeal>& mIdeal;
 	Datastructure<Configuration<InputPolynomial>> mDatastruct;
@@ -99,10 +120,61 @@ public:
 	virtual ~Reductor()	= default;
 
 	/**
-	 * The basic reduce routine on a priority queue.
+	 * The basic reduce routine.
 	 * @return 
 	 */
 	bool reduce()
+	{
+		if constexpr (accumulating) {
+			return reduceAccumulated();
+		} else {
+			return reduceEntries();
+		}
+	}
+
+	/**
+	 * Gets the flag which indicates that a reduction has occurred  (p -> p' with p' != p)
+	 * @return the value of the flag
+	 */
+	bool reductionOccured()
+	{
+		return mReductionOccured;
+	}
+
+	/**
+	 * Uses the ideal to reduce a polynomial as far as possible.
+	 * @return 
+	 */
+	InputPolynomial fullReduce()
+	{
+		//std::cout << "start full reduce" << std::endl;
+		// TODO:
+		// Do simple reductions first.
+		while(!reduce())
+		{
+		//	std::cout << "done reducing" << std::endl;
+			// no operation.
+		}
+		// TODO check whether this is sorted.
+		InputPolynomial result(std::move(mRemainder), true, false);
+		if(InputPolynomial::Policy::has_reasons)
+		{
+			result.setReasons(mReasons);
+			mReasons.clear();
+		}
+		//std::cout << "done full reduce" << std::endl;
+		return result;
+				
+	}
+	
+	
+private:
+
+	/**
+	 * The reduce routine on a priority queue of ReductorEntry objects.
+	 * @return 
+	 */
+	bool reduceEntries()
 	{
 		while(!mDatastruct.empty())
 		{
@@ -166,46 +238,37 @@ public:
 	}
 
 	/**
-	 * Gets the flag which indicates that a reduction has occurred  (p -> p' with p' != p)
-	 * @return the value of the flag
-	 */
-	bool reductionOccured()
-	{
-		return mReductionOccured;
-	}
-
-	/**
-	 * Uses the ideal to reduce a polynomial as far as possible.
+	 * The reduce routine if the datastructure accumulates all partial reductions in a single polynomial.
 	 * @return 
 	 */
-	InputPolynomial fullReduce()
+	bool reduceAccumulated()
 	{
-		//std::cout << "start full reduce" << std::endl;
-		// TODO:
-		// Do simple reductions first.
-		while(!reduce())
-		{
-		//	std::cout << "done reducing" << std::endl;
-			// no operation.
-		}
-		// TODO check whether this is sorted.
-		InputPolynomial result(std::move(mRemainder), true, false);
-		if(InputPolynomial::Policy::has_reasons)
+		while(!mDatastruct.empty())
 		{
-			result.setReasons(mReasons);
-			mReasons.clear();
+			Term<Coeff> leadingTerm = mDatastruct.lterm();
+			CARL_LOG_TRACE("carl.gb.reductor", "Intermediate leading term: " << leadingTerm);
+			mDatastruct.strip_lterm();
+			DivisionLookupResult<PolynomialInIdeal> divres(mIdeal.getDivisor(leadingTerm));
+			if(divres.success())
+			{
+				mReductionOccured = true;
+				if(PolynomialInIdeal::Policy::has_reasons)
+				{
+					mReasons.calculateUnion(divres.mDivisor->getReasons());
+				}
+				// The leading terms cancel, hence only the tail of the divisor is added.
+				mDatastruct.add(divres.mFactor, *divres.mDivisor, 1);
+			}
+			else
+			{
+				CARL_LOG_DEBUG("carl.gb.reductor", "Not reducible: " << leadingTerm);
+				mRemainder.push_back(leadingTerm);
+				return false;
+			}
 		}
-		//std::cout << "done full reduce" << std::endl;
-		return result;
-				
+		return true;
 	}
-	
-	
-private:
 
- 	
-	
-	
 	/**
 	 * A small routine which updates the underlying data structure for the polynomial which is reduced.
 	 * @param entry
@@ -231,7 +294,10 @@ private:
 
 	void insert(const InputPolynomial& g, const Term<Coeff>& fact)
 	{
-		if(!is_zero(g))
+		if constexpr (accumulating) {
+			mDatastruct.add(fact, g);
+		}
+		else if(!is_zero(g))
 		{
 			CARL_LOG_TRACE("carl.gb.reductor", "Insert polynomial: " << g << " * " << fact);
 			mDatastruct.push(new EntryType(fact, g));
@@ -241,7 +307,11 @@ private:
 	void insert(const Term<Coeff>& g)
 	{
 		assert(g.getCoeff() != 0);
-		mDatastruct.push(new EntryType(g));
+		if constexpr (accumulating) {
+			mDatastruct.add(g);
+		} else {
+			mDatastruct.push(new EntryType(g));
+		}
 	}
 
 
@@ -64,6 +64,14 @@ public:
         mNrOfNonZeroReductions++;
     }
 
+    /**
+     * Count that an S-Pair was discarded by a criterion instead of being reduced
+     */
+    void AvoidedReduction( )
+    {
+        mNrOfAvoidedReductions++;
+    }
+
     unsigned getNrTSQWithConstant( ) const
     {
         return mNrOfTSQWithConstant;
@@ -83,6 +91,26 @@ public:
     {
         return mNrOfReducibleIdentities;
     }
+
+    unsigned getNrReductions( ) const
+    {
+        return mNrOfReductions;
+    }
+
+    unsigned getNrNonZeroReductions( ) const
+    {
+        return mNrOfNonZeroReductions;
+    }
+
+    unsigned getNrZeroReductions( ) const
+    {
+        return mNrOfReductions - mNrOfNonZeroReductions;
+    }
+
+    unsigned getNrAvoidedReductions( ) const
+    {
+        return mNrOfAvoidedReductions;
+    }
 protected:
 
     BuchbergerStats( ) :
@@ -91,7 +119,8 @@ protected:
     mNrOfSingleTermSFP( 0 ),
     mNrOfReducibleIdentities( 0 ),
     mNrOfReductions( 0 ),
-    mNrOfNonZeroReductions( 0 )
+    mNrOfNonZeroReductions( 0 ),
+    mNrOfAvoidedReductions( 0 )
     {
     }
     unsigned mNrOfTSQWithConstant;
@@ -100,6 +129,7 @@ protected:
     unsigned mNrOfReducibleIdentities;
     unsigned mNrOfReductions;
     unsigned mNrOfNonZeroReductions;
+    unsigned mNrOfAvoidedReductions;
 
 private:
     static BuchbergerStats* instance;
@@ -0,0 +1,86 @@
+/**
+ * @file Signature.h
+ * @ingroup gb
+ */
+#pragma once
+
+#include <carl-arith/core/CompareResult.h>
+#include <carl-arith/poly/umvpoly/Monomial.h>
+
+#include <ostream>
+
+namespace carl
+{
+
+/**
+ * The signature m * e_i of a polynomial.
+ * It is the leading monomial of a representation of the polynomial in terms of the input polynomials f_i.
+ * Signatures are ordered position over term, i.e. by the index first and by the monomial afterwards.
+ * @ingroup gb
+ */
+struct Signature
+{
+	/// The monomial m, nullptr encodes the monomial 1.
+	Monomial::Arg mMonomial;
+	/// The index i of the unit vector e_i.
+	std::size_t mIndex;
+
+	Signature(Monomial::Arg monomial, std::size_t index): mMonomial(std::move(monomial)), mIndex(index)
+	{}
+
+	/**
+	 * @param m Monomial.
+	 * @return m * this.
+	 */
+	Signature operator*(const Monomial::Arg& m) const
+	{
+		return Signature(mMonomial * m, mIndex);
+	}
+
+	/**
+	 * Checks whether this signature is a multiple of the given signature.
+	 * @param s Signature.
+	 * @return If s divides this.
+	 */
+	bool divisible(const Signature& s) const
+	{
+		if(mIndex != s.mIndex) return false;
+		if(!mMonomial) return !s.mMonomial;
+		return mMonomial->divisible(s.mMonomial);
+	}
+
+	/**
+	 * Compares two signatures position over term.
+	 */
+	template<typename Order>
+	static CompareResult compare(const Signature& lhs, const Signature& rhs)
+	{
+		if(lhs.mIndex < rhs.mIndex) return CompareResult::LESS;
+		if(lhs.mIndex > rhs.mIndex) return CompareResult::GREATER;
+		return Order::compare(lhs.mMonomial, rhs.mMonomial);
+	}
+
+	template<typename Order>
+	static bool less(const Signature& lhs, const Signature& rhs)
+	{
+		return compare<Order>(lhs, rhs) == CompareResult::LESS;
+	}
+};
+
+inline bool operator==(const Signature& lhs, const Signature& rhs)
+{
+	return lhs.mIndex == rhs.mIndex && lhs.mMonomial == rhs.mMonomial;
+}
+
+inline bool operator!=(const Signature& lhs, const Signature& rhs)
+{
+	return !(lhs == rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const Signature& s)
+{
+	if(s.mMonomial) os << *s.mMonomial << " * ";
+	return os << "e" << s.mIndex;
+}
+
+}
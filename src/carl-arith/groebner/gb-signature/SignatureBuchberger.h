@@ -0,0 +1,133 @@
+/**
+ * @file SignatureBuchberger.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include "../GBUpdateProcedures.h"
+#include "../Ideal.h"
+#include "../gb-buchberger/BuchbergerStats.h"
+#include "Signature.h"
+
+#include <carl-arith/poly/umvpoly/Geobucket.h>
+#include <carl-common/datastructures/BitVector.h>
+
+#include <list>
+#include <queue>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Signature based variant of the Buchberger algorithm.
+ *
+ * Every polynomial is labeled with its signature and S-pairs are processed in increasing signature order
+ * using only regular reductions, i.e. reductions which do not increase the signature.
+ * This allows to discard S-pairs without reducing them by the following criteria:
+ * - Syzygy criterion: the signature is a multiple of the signature of a known syzygy.
+ *   Known syzygies are the principal (Koszul) syzygies of the basis elements and the syzygies found by reductions to zero.
+ * - Rewrite criterion: the signature is a multiple of the signature of a basis element which was added later.
+ *   In particular, only one S-pair is reduced for every signature.
+ *
+ * The number of S-pairs discarded this way is reported via BuchbergerStats::getNrAvoidedReductions().
+ *
+ * The procedure computes a Groebner basis of all generators of the current ideal and the scheduled polynomials.
+ * The AddingPolicy is only applied to the final basis elements, hence policies which change the ideal
+ * (like RealRadicalAwareAdding) do not yield a Groebner basis with this procedure.
+ * @see Roune and Stillman, Practical Groebner basis computation, ISSAC 2012.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class SignatureBuchberger : private AddingPolicy<Polynomial>
+{
+protected:
+	using Order = typename Polynomial::OrderedBy;
+	using Coeff = typename Polynomial::CoeffType;
+
+	/// A basis element together with its signature.
+	struct LabeledPolynomial
+	{
+		Signature mSignature;
+		Polynomial mPolynomial;
+	};
+
+	/**
+	 * An S-pair (mMultiple * g_mGenerator - mOtherMultiple * g_mOther) with signature mMultiple * sig(g_mGenerator).
+	 * If mOther is no_other, it represents the mGenerator-th input polynomial.
+	 */
+	struct SignaturePair
+	{
+		Signature mSignature;
+		std::size_t mGenerator;
+		Monomial::Arg mMultiple;
+		std::size_t mOther;
+		Monomial::Arg mOtherMultiple;
+	};
+
+	/// Orders pairs such that the pair with the smallest signature is on top.
+	/// Among pairs of equal signature, the pair of the most recent basis element is on top.
+	struct SignaturePairCompare
+	{
+		bool operator()(const SignaturePair& lhs, const SignaturePair& rhs) const
+		{
+			switch(Signature::compare<Order>(lhs.mSignature, rhs.mSignature))
+			{
+				case CompareResult::LESS: return false;
+				case CompareResult::GREATER: return true;
+				case CompareResult::EQUAL: return lhs.mGenerator < rhs.mGenerator;
+			}
+			return false;
+		}
+	};
+
+	using PairQueue = std::priority_queue<SignaturePair, std::vector<SignaturePair>, SignaturePairCompare>;
+
+	static constexpr std::size_t no_other = std::size_t(-1);
+
+	struct NoUpdate : UpdateFnc
+	{
+		void operator()(std::size_t /*index*/) override {}
+	};
+
+	std::shared_ptr<Ideal<Polynomial>> pGb;
+	/// The labeled basis, in the order the elements were found.
+	std::vector<LabeledPolynomial> mBasis;
+	/// Signatures of known syzygies.
+	std::vector<Signature> mSyzygies;
+	BuchbergerStats* mStats;
+
+public:
+	SignatureBuchberger():
+		pGb(),
+		mStats(BuchbergerStats::getInstance())
+	{
+	}
+
+	virtual ~SignatureBuchberger() = default;
+
+	SignatureBuchberger(const SignatureBuchberger& rhs):
+		pGb(new Ideal<Polynomial>(*rhs.pGb)),
+		mStats(rhs.mStats)
+	{
+	}
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+	void setIdeal(const std::shared_ptr<Ideal<Polynomial>>& ideal)
+	{
+		pGb = ideal;
+	}
+
+protected:
+	bool isSyzygySignature(const Signature& s) const;
+	bool isRewritable(const SignaturePair& pair) const;
+	bool isSingularTopReducible(const Polynomial& p, const Signature& s) const;
+	Polynomial regularReduce(Geobucket<Polynomial>& p, const Signature& s, BitVector& reasons) const;
+	void addToBasis(Polynomial&& p, const Signature& s, PairQueue& pairs);
+	void setConstant(const BitVector& reasons);
+};
+
+}
+
+#include "SignatureBuchberger.tpp"
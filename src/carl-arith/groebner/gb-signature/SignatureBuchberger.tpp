@@ -0,0 +1,244 @@
+/**
+ * @file SignatureBuchberger.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "SignatureBuchberger.h"
+
+#include <algorithm>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void SignatureBuchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.signature", "Calculate gb");
+	std::vector<Polynomial> input;
+	for(const Polynomial& p : pGb->getGenerators())
+	{
+		if(!is_zero(p)) input.push_back(p);
+	}
+	for(const Polynomial& p : scheduledForAdding)
+	{
+		if(!is_zero(p)) input.push_back(p);
+	}
+	mBasis.clear();
+	mSyzygies.clear();
+
+	PairQueue pairs;
+	for(std::size_t i = 0; i < input.size(); ++i)
+	{
+		if(input[i].is_constant())
+		{
+			CARL_LOG_INFO("carl.gb.signature", "Added a constant polynomial.");
+			setConstant(input[i].getReasons());
+			return;
+		}
+		pairs.push(SignaturePair{Signature(nullptr, i), i, nullptr, no_other, nullptr});
+	}
+
+	while(!pairs.empty())
+	{
+		SignaturePair pair = pairs.top();
+		pairs.pop();
+		// Only the first pair of every signature is considered, all others are rewritable.
+		while(!pairs.empty() && pairs.top().mSignature == pair.mSignature)
+		{
+			mStats->AvoidedReduction();
+			pairs.pop();
+		}
+		if(isSyzygySignature(pair.mSignature))
+		{
+			CARL_LOG_TRACE("carl.gb.signature", "Syzygy criterion: " << pair.mSignature);
+			mStats->AvoidedReduction();
+			continue;
+		}
+
+		Geobucket<Polynomial> spol;
+		BitVector reasons;
+		if(pair.mOther == no_other)
+		{
+			spol.add(input[pair.mGenerator]);
+			reasons = input[pair.mGenerator].getReasons();
+		}
+		else
+		{
+			if(isRewritable(pair))
+			{
+				CARL_LOG_TRACE("carl.gb.signature", "Rewrite criterion: " << pair.mSignature);
+				mStats->AvoidedReduction();
+				continue;
+			}
+			const Polynomial& g1 = mBasis[pair.mGenerator].mPolynomial;
+			const Polynomial& g2 = mBasis[pair.mOther].mPolynomial;
+			// Basis elements are normalized, hence the leading terms cancel.
+			spol.add(Term<Coeff>(Coeff(1), pair.mMultiple), g1, 1);
+			spol.add(Term<Coeff>(Coeff(-1), pair.mOtherMultiple), g2, 1);
+			reasons = g1.getReasons() | g2.getReasons();
+		}
+		mStats->TreatSPair();
+		Polynomial remainder = regularReduce(spol, pair.mSignature, reasons);
+		CARL_LOG_DEBUG("carl.gb.signature", "Remainder of SPol with signature " << pair.mSignature << ": " << remainder);
+		if(is_zero(remainder))
+		{
+			mSyzygies.push_back(pair.mSignature);
+			continue;
+		}
+		mStats->NonZeroReduction();
+		if(remainder.is_constant())
+		{
+			setConstant(remainder.getReasons());
+			return;
+		}
+		if(isSingularTopReducible(remainder, pair.mSignature))
+		{
+			continue;
+		}
+		addToBasis(remainder.normalize(), pair.mSignature, pairs);
+	}
+
+	pGb->clear();
+	NoUpdate noUpdate;
+	for(const LabeledPolynomial& lp : mBasis)
+	{
+		if(AddingPolicy<Polynomial>::addToGb(lp.mPolynomial, pGb, &noUpdate)) break;
+	}
+	mBasis.clear();
+	mSyzygies.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool SignatureBuchberger<Polynomial, AddingPolicy>::isSyzygySignature(const Signature& s) const
+{
+	return std::any_of(mSyzygies.begin(), mSyzygies.end(), [&s](const Signature& syz){ return s.divisible(syz); });
+}
+
+/**
+ * A pair is rewritable, if its signature is a multiple of the signature of a basis element which was added after the generator of the pair.
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+bool SignatureBuchberger<Polynomial, AddingPolicy>::isRewritable(const SignaturePair& pair) const
+{
+	for(std::size_t k = pair.mGenerator + 1; k < mBasis.size(); ++k)
+	{
+		if(pair.mSignature.divisible(mBasis[k].mSignature)) return true;
+	}
+	return false;
+}
+
+/**
+ * Checks whether the leading term of p can be reduced by a basis element without decreasing the signature s.
+ * In this case, p is redundant.
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+bool SignatureBuchberger<Polynomial, AddingPolicy>::isSingularTopReducible(const Polynomial& p, const Signature& s) const
+{
+	for(const LabeledPolynomial& g : mBasis)
+	{
+		Monomial::Arg factor;
+		if(p.lmon()->divide(g.mPolynomial.lmon(), factor) && g.mSignature * factor == s)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Fully reduces p with respect to the basis, using only reductions that keep the signature s.
+ * The reasons of all used basis elements are added to reasons.
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+Polynomial SignatureBuchberger<Polynomial, AddingPolicy>::regularReduce(Geobucket<Polynomial>& p, const Signature& s, BitVector& reasons) const
+{
+	// Terms of the result are found in descending order.
+	std::vector<Term<Coeff>> terms;
+	while(!p.empty())
+	{
+		const Term<Coeff>& lt = p.lterm();
+		bool reduced = false;
+		for(const LabeledPolynomial& g : mBasis)
+		{
+			Term<Coeff> factor;
+			if(lt.divide(g.mPolynomial.lterm(), factor) && Signature::less<Order>(g.mSignature * factor.monomial(), s))
+			{
+				if(Polynomial::Policy::has_reasons)
+				{
+					reasons.calculateUnion(g.mPolynomial.getReasons());
+				}
+				p.strip_lterm();
+				p.add(-factor, g.mPolynomial, 1);
+				reduced = true;
+				break;
+			}
+		}
+		if(!reduced)
+		{
+			terms.push_back(lt);
+			p.strip_lterm();
+		}
+	}
+	std::reverse(terms.begin(), terms.end());
+	Polynomial res(std::move(terms), false, true);
+	res.setReasons(reasons);
+	return res;
+}
+
+/**
+ * Adds a new basis element, the principal syzygies with all other basis elements and the new S-pairs.
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void SignatureBuchberger<Polynomial, AddingPolicy>::addToBasis(Polynomial&& p, const Signature& s, PairQueue& pairs)
+{
+	CARL_LOG_DEBUG("carl.gb.signature", "Add to gb: " << p << " with signature " << s);
+	std::size_t index = mBasis.size();
+	mBasis.push_back(LabeledPolynomial{s, std::move(p)});
+	const LabeledPolynomial& g = mBasis.back();
+	for(std::size_t k = 0; k < index; ++k)
+	{
+		const LabeledPolynomial& other = mBasis[k];
+		// Signatures of g * lt(other) - other * lt(g)
+		Signature sk = s * other.mPolynomial.lmon();
+		Signature sg = other.mSignature * g.mPolynomial.lmon();
+		if(sk != sg)
+		{
+			Signature syz = Signature::less<Order>(sk, sg) ? sg : sk;
+			if(!isSyzygySignature(syz)) mSyzygies.push_back(syz);
+		}
+		// Multiples for the S-pair
+		Monomial::Arg mg = Monomial::calcLcmAndDivideBy(other.mPolynomial.lmon(), g.mPolynomial.lmon());
+		Monomial::Arg mk = Monomial::calcLcmAndDivideBy(g.mPolynomial.lmon(), other.mPolynomial.lmon());
+		Signature pg = s * mg;
+		Signature pk = other.mSignature * mk;
+		switch(Signature::compare<Order>(pg, pk))
+		{
+			case CompareResult::LESS:
+				pairs.push(SignaturePair{pk, k, mk, index, mg});
+				break;
+			case CompareResult::GREATER:
+				pairs.push(SignaturePair{pg, index, mg, k, mk});
+				break;
+			case CompareResult::EQUAL:
+				// Singular pair, the S-polynomial has a smaller signature and is covered by other pairs.
+				mStats->AvoidedReduction();
+				break;
+		}
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void SignatureBuchberger<Polynomial, AddingPolicy>::setConstant(const BitVector& reasons)
+{
+	pGb->clear();
+	Polynomial q(1);
+	q.setReasons(reasons);
+	pGb->addGenerator(q);
+	mBasis.clear();
+	mSyzygies.clear();
+}
+
+}
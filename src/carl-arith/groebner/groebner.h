@@ -9,4 +9,5 @@
 
 #include "GBProcedure.h"
 #include "gb-buchberger/Buchberger.h"
+#include "gb-signature/SignatureBuchberger.h"
 #include "Reductor.h"
\ No newline at end of file
@@ -0,0 +1,291 @@
+#pragma once
+
+#include "Interval.h"
+#include <carl-arith/core/Variable.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A dense assignment of double intervals to variables.
+ *
+ * The bounds are stored in separate arrays (structure of arrays), unbounded sides are represented by infinities.
+ * Variables are mapped to their position via tables indexed by the variable id, one table for every variable type.
+ * Positions are stable: variables are only ever appended.
+ *
+ * An IntervalBox can be used instead of `std::map<Variable, Interval<double>>` for interval evaluation and contraction.
+ * Intersection of boxes over the same variables works on the bound arrays directly.
+ */
+class IntervalBox {
+public:
+	static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+private:
+	static constexpr double inf = std::numeric_limits<double>::infinity();
+
+	std::vector<Variable> mVariables;
+	std::vector<double> mLower;
+	std::vector<double> mUpper;
+	std::vector<std::uint8_t> mLowerStrict;
+	std::vector<std::uint8_t> mUpperStrict;
+	std::array<std::vector<std::size_t>, static_cast<std::size_t>(VariableType::TYPE_SIZE)> mPositions;
+
+	static std::size_t type_index(Variable v) {
+		return static_cast<std::size_t>(v.type()) - static_cast<std::size_t>(VariableType::MIN_TYPE);
+	}
+
+	void store(std::size_t pos, const Interval<double>& i) {
+		if (i.lower_bound_type() == BoundType::INFTY) {
+			mLower[pos] = -inf;
+			mLowerStrict[pos] = 0;
+		} else {
+			mLower[pos] = i.lower();
+			mLowerStrict[pos] = i.lower_bound_type() == BoundType::STRICT;
+		}
+		if (i.upper_bound_type() == BoundType::INFTY) {
+			mUpper[pos] = inf;
+			mUpperStrict[pos] = 0;
+		} else {
+			mUpper[pos] = i.upper();
+			mUpperStrict[pos] = i.upper_bound_type() == BoundType::STRICT;
+		}
+	}
+	void intersect_at(std::size_t pos, double l, bool ls, double u, bool us) {
+		if (l > mLower[pos]) {
+			mLower[pos] = l;
+			mLowerStrict[pos] = ls;
+		} else if (l == mLower[pos]) {
+			mLowerStrict[pos] |= static_cast<std::uint8_t>(ls);
+		}
+		if (u < mUpper[pos]) {
+			mUpper[pos] = u;
+			mUpperStrict[pos] = us;
+		} else if (u == mUpper[pos]) {
+			mUpperStrict[pos] |= static_cast<std::uint8_t>(us);
+		}
+	}
+public:
+	IntervalBox() = default;
+
+	/// Creates a box where all given variables are unbounded.
+	explicit IntervalBox(const std::vector<Variable>& vars) {
+		for (auto v: vars) add(v);
+	}
+
+	/// Creates a box from an interval map.
+	explicit IntervalBox(const std::map<Variable, Interval<double>>& map) {
+		for (const auto& [v, i]: map) set(v, i);
+	}
+
+	std::size_t size() const {
+		return mVariables.size();
+	}
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// Lower bounds, -infinity if unbounded.
+	const std::vector<double>& lower() const {
+		return mLower;
+	}
+	/// Upper bounds, infinity if unbounded.
+	const std::vector<double>& upper() const {
+		return mUpper;
+	}
+
+	/**
+	 * Returns the position of the given variable.
+	 * @return Position or npos if the variable is not part of this box.
+	 */
+	std::size_t position(Variable v) const {
+		const auto& table = mPositions[type_index(v)];
+		if (v.id() >= table.size()) return npos;
+		return table[v.id()];
+	}
+	bool has(Variable v) const {
+		return position(v) != npos;
+	}
+
+	/**
+	 * Adds the given variable as unbounded, if it is not yet part of this box.
+	 * @return Position of the variable.
+	 */
+	std::size_t add(Variable v) {
+		auto& table = mPositions[type_index(v)];
+		if (v.id() >= table.size()) table.resize(v.id() + 1, npos);
+		if (table[v.id()] != npos) return table[v.id()];
+		table[v.id()] = mVariables.size();
+		mVariables.emplace_back(v);
+		mLower.emplace_back(-inf);
+		mUpper.emplace_back(inf);
+		mLowerStrict.emplace_back(0);
+		mUpperStrict.emplace_back(0);
+		return mVariables.size() - 1;
+	}
+
+	void set(std::size_t pos, const Interval<double>& i) {
+		assert(pos < size());
+		store(pos, i);
+	}
+	void set(Variable v, const Interval<double>& i) {
+		store(add(v), i);
+	}
+
+	Interval<double> interval(std::size_t pos) const {
+		assert(pos < size());
+		return Interval<double>(
+			mLower[pos], std::isinf(mLower[pos]) ? BoundType::INFTY : (mLowerStrict[pos] ? BoundType::STRICT : BoundType::WEAK),
+			mUpper[pos], std::isinf(mUpper[pos]) ? BoundType::INFTY : (mUpperStrict[pos] ? BoundType::STRICT : BoundType::WEAK)
+		);
+	}
+	/// Returns the interval of the given variable, which must be part of this box.
+	Interval<double> interval(Variable v) const {
+		assert(has(v));
+		return interval(position(v));
+	}
+
+	bool is_empty(std::size_t pos) const {
+		return mLower[pos] > mUpper[pos] || (mLower[pos] == mUpper[pos] && (mLowerStrict[pos] | mUpperStrict[pos]));
+	}
+	/// Checks whether any of the intervals is empty.
+	bool is_empty() const {
+		for (std::size_t i = 0; i < size(); ++i) {
+			if (is_empty(i)) return true;
+		}
+		return false;
+	}
+
+	/// Width of the interval at the given position, infinity if unbounded.
+	double width(std::size_t pos) const {
+		return mUpper[pos] - mLower[pos];
+	}
+	std::vector<double> widths() const {
+		std::vector<double> res(size());
+		for (std::size_t i = 0; i < res.size(); ++i) {
+			res[i] = mUpper[i] - mLower[i];
+		}
+		return res;
+	}
+	/// Position of the widest interval, npos if the box has no variables.
+	std::size_t widest() const {
+		std::size_t res = npos;
+		double best = -inf;
+		for (std::size_t i = 0; i < size(); ++i) {
+			double w = mUpper[i] - mLower[i];
+			if (w > best) {
+				best = w;
+				res = i;
+			}
+		}
+		return res;
+	}
+
+	/**
+	 * Returns the midpoint of the interval at the given position.
+	 * Unbounded intervals are treated like in carl::center().
+	 */
+	double midpoint(std::size_t pos) const {
+		bool li = std::isinf(mLower[pos]);
+		bool ui = std::isinf(mUpper[pos]);
+		if (li && ui) return 0;
+		if (li) return std::floor(mUpper[pos]) - 1;
+		if (ui) return std::ceil(mLower[pos]) + 1;
+		return mLower[pos] + (mUpper[pos] - mLower[pos]) / 2;
+	}
+	std::vector<double> midpoints() const {
+		std::vector<double> res(size());
+		for (std::size_t i = 0; i < res.size(); ++i) {
+			res[i] = midpoint(i);
+		}
+		return res;
+	}
+
+	/**
+	 * Splits the box at the midpoint of the given position.
+	 * Like Interval::split(), the lower part excludes the midpoint and the upper part includes it.
+	 */
+	std::pair<IntervalBox, IntervalBox> split(std::size_t pos) const {
+		assert(pos < size() && !is_empty(pos));
+		double mid = midpoint(pos);
+		std::pair<IntervalBox, IntervalBox> res(*this, *this);
+		res.first.mUpper[pos] = mid;
+		res.first.mUpperStrict[pos] = 1;
+		res.second.mLower[pos] = mid;
+		res.second.mLowerStrict[pos] = 0;
+		return res;
+	}
+
+	/**
+	 * Intersects this box with the given box.
+	 * Variables that are not part of this box are added.
+	 * If both boxes have the same variables in the same order, the bound arrays are processed without branches.
+	 */
+	IntervalBox& intersect_assign(const IntervalBox& rhs) {
+		if (mVariables == rhs.mVariables) {
+			for (std::size_t i = 0; i < mLower.size(); ++i) {
+				double l1 = mLower[i];
+				double l2 = rhs.mLower[i];
+				double u1 = mUpper[i];
+				double u2 = rhs.mUpper[i];
+				mLowerStrict[i] = static_cast<std::uint8_t>(((l1 >= l2) & mLowerStrict[i]) | ((l2 >= l1) & rhs.mLowerStrict[i]));
+				mUpperStrict[i] = static_cast<std::uint8_t>(((u1 <= u2) & mUpperStrict[i]) | ((u2 <= u1) & rhs.mUpperStrict[i]));
+				mLower[i] = std::max(l1, l2);
+				mUpper[i] = std::min(u1, u2);
+			}
+		} else {
+			for (std::size_t i = 0; i < rhs.size(); ++i) {
+				intersect_at(add(rhs.mVariables[i]), rhs.mLower[i], rhs.mLowerStrict[i], rhs.mUpper[i], rhs.mUpperStrict[i]);
+			}
+		}
+		return *this;
+	}
+
+	/// Converts this box to an interval map.
+	std::map<Variable, Interval<double>> to_map() const {
+		std::map<Variable, Interval<double>> res;
+		for (std::size_t i = 0; i < size(); ++i) {
+			res.emplace(mVariables[i], interval(i));
+		}
+		return res;
+	}
+};
+
+/**
+ * Intersects two boxes.
+ * @see IntervalBox::intersect_assign
+ */
+inline IntervalBox set_intersection(const IntervalBox& lhs, const IntervalBox& rhs) {
+	IntervalBox res(lhs);
+	res.intersect_assign(rhs);
+	return res;
+}
+
+/// Two boxes are equal if they assign equal intervals to the same variables, regardless of the order.
+inline bool operator==(const IntervalBox& lhs, const IntervalBox& rhs) {
+	if (lhs.size() != rhs.size()) return false;
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		auto pos = rhs.position(lhs.variables()[i]);
+		if (pos == IntervalBox::npos || !(lhs.interval(i) == rhs.interval(pos))) return false;
+	}
+	return true;
+}
+inline bool operator!=(const IntervalBox& lhs, const IntervalBox& rhs) {
+	return !(lhs == rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const IntervalBox& box) {
+	os << "{";
+	for (std::size_t i = 0; i < box.size(); ++i) {
+		if (i > 0) os << ", ";
+		os << box.variables()[i] << " -> " << box.interval(i);
+	}
+	return os << "}";
+}
+
+}
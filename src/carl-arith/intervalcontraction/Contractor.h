@@ -4,6 +4,7 @@
 #include <carl-arith/core/Variables.h>
 #include <carl-arith/constraint/BasicConstraint.h>
 #include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBox.h>
 #include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
 #include <carl-arith/interval/set_theory.h>
 
@@ -135,15 +136,42 @@ public:
 	 */
 	template<typename Number>
 	std::vector<Interval<Number>> evaluate(const std::map<Variable, Interval<Number>>& assignment, const Interval<Number>& h = Interval<Number>(0,0)) const {
-		std::vector<Interval<Number>> res;
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating on " << assignment);
 		auto num = carl::evaluate(numerator(), assignment);
 		CARL_LOG_DEBUG("carl.contractor", numerator() << " -> " << num);
 		num += h;
 		CARL_LOG_DEBUG("carl.contractor", "Subtracting " << h << " -> " << num);
 		if (!is_one(denominator())) {
-			auto den = carl::evaluate(denominator(), assignment);;
+			auto den = carl::evaluate(denominator(), assignment);
 			CARL_LOG_DEBUG("carl.contractor", denominator() << " -> " << den);
+			return solve(num, den);
+		}
+		return solve(num, Interval<Number>(1));
+	}
+
+	/**
+	 * Evaluate this contraction over the given box.
+	 * @see evaluate(const std::map<Variable, Interval<Number>>&, const Interval<Number>&)
+	 */
+	std::vector<Interval<double>> evaluate(const IntervalBox& box, const Interval<double>& h = Interval<double>(0,0)) const {
+		CARL_LOG_DEBUG("carl.contractor", "Evaluating on " << box);
+		auto num = carl::evaluate(numerator(), box);
+		num += h;
+		if (!is_one(denominator())) {
+			return solve(num, carl::evaluate(denominator(), box));
+		}
+		return solve(num, Interval<double>(1));
+	}
+
+	/**
+	 * Solves for the variable, given the values of the numerator (already shifted by h) and the denominator.
+	 * The value of the denominator is ignored if the denominator is one.
+	 * Returns a list of resulting intervals.
+	 */
+	template<typename Number>
+	std::vector<Interval<Number>> solve(const Interval<Number>& num, const Interval<Number>& den) const {
+		std::vector<Interval<Number>> res;
+		if (!is_one(denominator())) {
 			Interval<Number> resA;
 			Interval<Number> resB;
 			if (num.div_ext(den, resA, resB)) {
@@ -227,6 +255,13 @@ public:
 	const auto& origin() const {
 		return mOrigin;
 	}
+	const auto& evaluation() const {
+		return mEvaluation;
+	}
+	/// The interval the left hand side of the constraint is restricted to.
+	const auto& relation() const {
+		return mRelation;
+	}
 
 	std::vector<Interval<Number>> evaluate(const std::map<Variable, Interval<Number>>& assignment) const {
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating " << mEvaluation << " on " << assignment);
@@ -252,6 +287,31 @@ public:
 		CARL_LOG_DEBUG("carl.contractor", "-> " << res);
 		return res;
 	}
+
+	std::vector<Interval<Number>> evaluate(const IntervalBox& box) const {
+		CARL_LOG_DEBUG("carl.contractor", "Evaluating " << mEvaluation << " on " << box);
+		return mEvaluation.evaluate(box, mRelation);
+	}
+
+	std::vector<Interval<Number>> contract(const IntervalBox& box) const {
+		assert(box.has(mEvaluation.var()));
+		auto res = evaluate(box);
+		auto cur = box.interval(mEvaluation.var());
+		CARL_LOG_DEBUG("carl.contractor", "Intersecting " << res << " with " << cur);
+
+		std::size_t last = 0;
+		for (std::size_t i = 0; i < res.size(); ++i) {
+			auto tmp = set_intersection(res[i], cur);
+			if (!tmp.is_empty()) {
+				res[last] = tmp;
+				last++;
+			}
+		}
+		res.resize(last);
+
+		CARL_LOG_DEBUG("carl.contractor", "-> " << res);
+		return res;
+	}
 };
 
 }
@@ -0,0 +1,333 @@
+#pragma once
+
+#include "Contractor.h"
+
+#include <carl-arith/core/Variable.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBox.h>
+#include <carl-arith/interval/set_theory.h>
+#include <carl-arith/poly/umvpoly/functions/DensePolynomial.h>
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <map>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace carl {
+namespace contractor {
+
+namespace detail_propagation {
+
+/**
+ * Measures how much an interval was contracted, relative to its former size.
+ * Removing an infinite bound counts as full contraction, moving a bound of an unbounded interval is measured relative to
+ * the magnitude of the bound.
+ */
+inline double relative_contraction(const Interval<double>& before, const Interval<double>& after) {
+	if (after.is_empty()) return 1;
+	if (before.lower_bound_type() != BoundType::INFTY && before.upper_bound_type() != BoundType::INFTY) {
+		double width = before.diameter();
+		if (width <= 0) return 0;
+		return (width - after.diameter()) / width;
+	}
+	auto infinite_bounds = [](const auto& i) {
+		return (i.lower_bound_type() == BoundType::INFTY) + (i.upper_bound_type() == BoundType::INFTY);
+	};
+	if (infinite_bounds(after) < infinite_bounds(before)) return 1;
+	double res = 0;
+	if (before.lower_bound_type() != BoundType::INFTY) {
+		res = std::max(res, std::abs(after.lower() - before.lower()) / std::max(1.0, std::abs(before.lower())));
+	}
+	if (before.upper_bound_type() != BoundType::INFTY) {
+		res = std::max(res, std::abs(after.upper() - before.upper()) / std::max(1.0, std::abs(before.upper())));
+	}
+	return res;
+}
+
+}
+
+/**
+ * Settings for a Propagation.
+ */
+struct PropagationSettings {
+	/// Contractions that reduce the width of an interval by less than this fraction are applied, but do not reactivate any contractor.
+	double min_relative_contraction = 0.01;
+	/// Maximal number of contractions per call to Propagation::propagate().
+	std::size_t max_contractions = 100000;
+	/// Whether contractors for different variables are run in parallel.
+	bool parallel = false;
+};
+
+enum class PropagationStatus {
+	/// No contractor can contract the box any further, up to the minimal relative contraction.
+	FIXPOINT,
+	/// Some contractor contracted an interval to the empty interval.
+	CONFLICT,
+	/// The maximal number of contractions was reached.
+	LIMIT
+};
+
+inline std::ostream& operator<<(std::ostream& os, PropagationStatus s) {
+	switch (s) {
+		case PropagationStatus::FIXPOINT: return os << "FIXPOINT";
+		case PropagationStatus::CONFLICT: return os << "CONFLICT";
+		case PropagationStatus::LIMIT: return os << "LIMIT";
+	}
+	return os;
+}
+
+/**
+ * Interval constraint propagation on a set of contractors.
+ *
+ * The propagation owns an IntervalBox with an interval for every variable, and the polynomials of all contractors are
+ * compiled against the positions in this box. Calling propagate() applies contractors until a fixpoint is reached: contractors are taken
+ * from a priority queue, and whenever a contractor shrinks the interval of a variable by at least the minimal relative
+ * contraction, all contractors that depend on this variable are reactivated with a priority given by this contraction.
+ * Contractors are reactivated across calls as well: changing the box via set_interval() or adding contractors only
+ * schedules the affected contractors.
+ *
+ * If enabled, the contractors with the highest priorities for pairwise different variables are evaluated in parallel on
+ * the current box. This is sound, as the box only shrinks and a contraction on a larger box is weaker, but still valid.
+ */
+template<typename Origin, typename Polynomial>
+class Propagation {
+public:
+	using ContractorType = Contractor<Origin, Polynomial, double>;
+private:
+	struct Entry {
+		ContractorType contractor;
+		std::size_t target;
+		DensePolynomial numerator;
+		DensePolynomial denominator;
+		/// Positions of the variables of the numerator and the denominator in the box.
+		std::vector<std::size_t> numerator_positions;
+		std::vector<std::size_t> denominator_positions;
+	};
+
+	PropagationSettings mSettings;
+	IntervalBox mBox;
+	std::vector<Entry> mContractors;
+	/// For every variable, the contractors that depend on it.
+	std::vector<std::vector<std::size_t>> mWatches;
+
+	std::priority_queue<std::pair<double, std::size_t>> mQueue;
+	/// The priority every contractor is queued with, or a negative value.
+	std::vector<double> mPriorities;
+
+	std::optional<Origin> mConflict;
+	std::size_t mContractions = 0;
+
+	std::size_t index(Variable v) {
+		std::size_t pos = mBox.add(v);
+		if (pos == mWatches.size()) mWatches.emplace_back();
+		return pos;
+	}
+	std::vector<std::size_t> positions(const DensePolynomial& p) {
+		std::vector<std::size_t> res;
+		for (auto v: p.variables()) res.emplace_back(index(v));
+		return res;
+	}
+
+	void schedule(std::size_t contractor, double priority) {
+		if (priority <= mPriorities[contractor]) return;
+		mPriorities[contractor] = priority;
+		mQueue.emplace(priority, contractor);
+	}
+	void reactivate(std::size_t variable, double priority) {
+		for (auto c: mWatches[variable]) schedule(c, priority);
+	}
+	/// Removes the contractor with the highest priority from the queue, skipping outdated entries.
+	std::optional<std::size_t> next() {
+		while (!mQueue.empty()) {
+			auto [priority, c] = mQueue.top();
+			mQueue.pop();
+			if (priority != mPriorities[c]) continue;
+			mPriorities[c] = -1;
+			return c;
+		}
+		return std::nullopt;
+	}
+	void clear_queue() {
+		mQueue = decltype(mQueue)();
+		std::fill(mPriorities.begin(), mPriorities.end(), -1);
+	}
+
+	/// Computes the new interval for the target variable of the given contractor on the given box.
+	Interval<double> contract(const Entry& e, const IntervalBox& box) const {
+		const auto& evaluation = e.contractor.evaluation();
+		auto num = e.numerator.evaluate(box, e.numerator_positions) + e.contractor.relation();
+		auto den = is_one(evaluation.denominator()) ? Interval<double>(1) : e.denominator.evaluate(box, e.denominator_positions);
+		auto cur = box.interval(e.target);
+		auto res = Interval<double>::empty_interval();
+		for (const auto& i: evaluation.solve(num, den)) {
+			auto tmp = set_intersection(i, cur);
+			if (tmp.is_empty()) continue;
+			res = res.is_empty() ? tmp : res.convex_hull(tmp);
+		}
+		if (box.variables()[e.target].type() == VariableType::VT_INT && !res.is_empty()) {
+			res = res.integral_part();
+		}
+		return res;
+	}
+	/// Applies the result of a contractor to the box. Returns false on a conflict.
+	bool apply(std::size_t c, const Interval<double>& result) {
+		++mContractions;
+		const auto& e = mContractors[c];
+		auto cur = mBox.interval(e.target);
+		auto res = set_intersection(result, cur);
+		if (res == cur) return true;
+		double gain = detail_propagation::relative_contraction(cur, res);
+		CARL_LOG_DEBUG("carl.contractor", "Contracted " << mBox.variables()[e.target] << " from " << cur << " to " << res << " (" << gain << ")");
+		mBox.set(e.target, res);
+		if (res.is_empty()) {
+			mConflict = e.contractor.origin();
+			clear_queue();
+			return false;
+		}
+		if (gain >= mSettings.min_relative_contraction) reactivate(e.target, gain);
+		return true;
+	}
+
+	/// Takes contractors with pairwise different variables from the queue, at most the given number.
+	std::vector<std::size_t> next_batch(std::size_t size) {
+		std::vector<std::size_t> batch;
+		std::vector<std::pair<std::size_t, double>> deferred;
+		std::vector<bool> used(mBox.size(), false);
+		while (batch.size() < size && !mQueue.empty()) {
+			auto [priority, c] = mQueue.top();
+			mQueue.pop();
+			if (priority != mPriorities[c]) continue;
+			mPriorities[c] = -1;
+			if (used[mContractors[c].target]) {
+				deferred.emplace_back(c, priority);
+				continue;
+			}
+			used[mContractors[c].target] = true;
+			batch.emplace_back(c);
+		}
+		for (const auto& [c, priority]: deferred) schedule(c, priority);
+		return batch;
+	}
+	/// Evaluates the given contractors on the current box in parallel.
+	std::vector<Interval<double>> contract_parallel(const std::vector<std::size_t>& batch) const {
+		std::vector<Interval<double>> results(batch.size());
+		std::size_t threads = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), batch.size());
+		std::size_t chunk = (batch.size() + threads - 1) / threads;
+		std::vector<std::future<void>> futures;
+		for (std::size_t start = 0; start < batch.size(); start += chunk) {
+			std::size_t end = std::min(start + chunk, batch.size());
+			futures.emplace_back(std::async(std::launch::async, [&, start, end]() {
+				for (std::size_t i = start; i < end; ++i) {
+					results[i] = contract(mContractors[batch[i]], mBox);
+				}
+			}));
+		}
+		for (auto& f: futures) f.get();
+		return results;
+	}
+public:
+	explicit Propagation(const PropagationSettings& settings = PropagationSettings()):
+		mSettings(settings)
+	{}
+
+	/// Adds a contractor and schedules it.
+	void add(const ContractorType& contractor) {
+		std::size_t target = index(contractor.var());
+		const auto& evaluation = contractor.evaluation();
+		DensePolynomial numerator(evaluation.numerator());
+		DensePolynomial denominator(evaluation.denominator());
+		auto numerator_positions = positions(numerator);
+		auto denominator_positions = positions(denominator);
+		mContractors.emplace_back(Entry{
+			contractor,
+			target,
+			std::move(numerator),
+			std::move(denominator),
+			std::move(numerator_positions),
+			std::move(denominator_positions)
+		});
+		std::size_t id = mContractors.size() - 1;
+		for (auto v: contractor.dependees()) {
+			mWatches[index(v)].emplace_back(id);
+		}
+		mPriorities.emplace_back(-1);
+		schedule(id, 1);
+	}
+	/// Adds contractors for all variables of the given constraint. Constraints with relation NEQ are ignored.
+	void add(const Origin& origin, const BasicConstraint<Polynomial>& constraint) {
+		if (constraint.relation() == Relation::NEQ) return;
+		carlVariables vars;
+		carl::variables(constraint, vars);
+		for (auto v: vars.as_vector()) {
+			add(ContractorType(origin, constraint, v));
+		}
+	}
+
+	/// Sets the interval of a variable and reactivates the contractors depending on it.
+	void set_interval(Variable v, const Interval<double>& interval) {
+		std::size_t i = index(v);
+		mBox.set(i, interval);
+		mConflict = std::nullopt;
+		reactivate(i, 1);
+	}
+	Interval<double> interval(Variable v) const {
+		assert(mBox.has(v));
+		return mBox.interval(v);
+	}
+
+	/// The variables, in the order of their positions in the box.
+	const std::vector<Variable>& variables() const {
+		return mBox.variables();
+	}
+	const IntervalBox& box() const {
+		return mBox;
+	}
+	std::map<Variable, Interval<double>> assignment() const {
+		return mBox.to_map();
+	}
+	const auto& contractors() const {
+		return mContractors;
+	}
+
+	/// The origin of the contractor that yielded the last conflict.
+	const std::optional<Origin>& conflict() const {
+		return mConflict;
+	}
+	/// The number of contractions done in the last call to propagate().
+	std::size_t contractions() const {
+		return mContractions;
+	}
+
+	/**
+	 * Propagates until a fixpoint or a conflict is reached, or the maximal number of contractions is exceeded.
+	 */
+	PropagationStatus propagate() {
+		mContractions = 0;
+		if (mConflict) return PropagationStatus::CONFLICT;
+		std::size_t batch_size = mSettings.parallel ? 4 * std::max(1u, std::thread::hardware_concurrency()) : 1;
+		while (mContractions < mSettings.max_contractions) {
+			if (batch_size > 1) {
+				auto batch = next_batch(std::min(batch_size, mSettings.max_contractions - mContractions));
+				if (batch.empty()) return PropagationStatus::FIXPOINT;
+				auto results = contract_parallel(batch);
+				for (std::size_t i = 0; i < batch.size(); ++i) {
+					if (!apply(batch[i], results[i])) return PropagationStatus::CONFLICT;
+				}
+			} else {
+				auto c = next();
+				if (!c) return PropagationStatus::FIXPOINT;
+				if (!apply(*c, contract(mContractors[*c], mBox))) return PropagationStatus::CONFLICT;
+			}
+		}
+		bool pending = std::any_of(mPriorities.begin(), mPriorities.end(), [](double p){ return p >= 0; });
+		return pending ? PropagationStatus::LIMIT : PropagationStatus::FIXPOINT;
+	}
+};
+
+}
+}
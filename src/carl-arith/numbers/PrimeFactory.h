@@ -63,6 +63,12 @@ namespace detail {
 		return res;
 	}
 
+	inline SmallInteger next_prime(const SmallInteger& n, const PrimeFactory<SmallInteger>&) {
+		mpz_class res;
+		mpz_nextprime(res.get_mpz_t(), n.to_mpz().get_mpz_t());
+		return SmallInteger(std::move(res));
+	}
+
 #ifdef USE_CLN_NUMBERS
 	inline cln::cl_I next_prime(const cln::cl_I& n, const PrimeFactory<cln::cl_I>&) {
 		return cln::nextprobprime(n + 1);
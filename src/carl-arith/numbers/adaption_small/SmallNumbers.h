@@ -0,0 +1,501 @@
+/**
+ * @file   adaption_small/SmallNumbers.h
+ * @ingroup small
+ *
+ * @warning This file should never be included directly but only via numbers.h
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include <carl-common/meta/SFINAE.h>
+#include "../adaption_gmpxx/include.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+
+namespace carl {
+
+namespace detail_small {
+	/// Largest value stored inline.
+	constexpr sint max = std::numeric_limits<sint>::max();
+	/// Smallest value stored inline. The minimum of sint is excluded, such that negation and abs never overflow.
+	constexpr sint min = -max;
+
+	inline bool fits(sint n) {
+		return n >= min;
+	}
+	inline bool fits(const mpz_class& n) {
+		static_assert(sizeof(signed long) == sizeof(sint), "inline values are converted via signed long");
+		return mpz_fits_slong_p(n.get_mpz_t()) && fits(sint(mpz_get_si(n.get_mpz_t())));
+	}
+
+	/// The following functions return false if the result does not fit.
+	inline bool add(sint a, sint b, sint& res) {
+		return !__builtin_add_overflow(a, b, &res) && fits(res);
+	}
+	inline bool sub(sint a, sint b, sint& res) {
+		return !__builtin_sub_overflow(a, b, &res) && fits(res);
+	}
+	inline bool mul(sint a, sint b, sint& res) {
+		return !__builtin_mul_overflow(a, b, &res) && fits(res);
+	}
+
+	inline sint gcd(sint a, sint b) {
+		return std::gcd(a, b);
+	}
+
+	inline mpz_class to_mpz(sint n) {
+		return mpz_class(static_cast<signed long>(n));
+	}
+}
+
+/**
+ * An arbitrary precision integer that is stored inline as long as it fits into a machine word.
+ *
+ * Values that do not fit are promoted to a heap-allocated mpz_class, results that fit again are demoted.
+ * Hence the representation of every value is unique, which keeps comparisons and hashing cheap.
+ * @ingroup small
+ */
+class SmallInteger {
+	sint mSmall = 0;
+	std::unique_ptr<mpz_class> mBig;
+
+	void assign(mpz_class&& n) {
+		if (detail_small::fits(n)) {
+			mSmall = mpz_get_si(n.get_mpz_t());
+			mBig.reset();
+		} else if (mBig) {
+			*mBig = std::move(n);
+		} else {
+			mBig = std::make_unique<mpz_class>(std::move(n));
+		}
+	}
+	void assign(sint n) {
+		mSmall = n;
+		mBig.reset();
+	}
+public:
+	SmallInteger() = default;
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	SmallInteger(T n) { // NOLINT
+		if constexpr (std::is_signed<T>::value) {
+			if (detail_small::fits(sint(n))) mSmall = sint(n);
+			else assign(detail_small::to_mpz(sint(n)));
+		} else {
+			if (n <= static_cast<std::make_unsigned<sint>::type>(detail_small::max)) mSmall = sint(n);
+			else assign(mpz_class(static_cast<unsigned long>(n)));
+		}
+	}
+	explicit SmallInteger(const mpz_class& n) {
+		assign(mpz_class(n));
+	}
+	explicit SmallInteger(mpz_class&& n) {
+		assign(std::move(n));
+	}
+	/// Parses a decimal integer, like mpz_class.
+	explicit SmallInteger(const std::string& s) {
+		assign(mpz_class(s));
+	}
+	explicit SmallInteger(const char* s): SmallInteger(std::string(s)) {}
+	SmallInteger(const SmallInteger& n):
+		mSmall(n.mSmall), mBig(n.mBig ? std::make_unique<mpz_class>(*n.mBig) : nullptr)
+	{}
+	SmallInteger(SmallInteger&& n) noexcept = default;
+	SmallInteger& operator=(const SmallInteger& n) {
+		if (this == &n) return *this;
+		if (!n.mBig) assign(n.mSmall);
+		else if (mBig) *mBig = *n.mBig;
+		else mBig = std::make_unique<mpz_class>(*n.mBig);
+		return *this;
+	}
+	SmallInteger& operator=(SmallInteger&& n) noexcept = default;
+	~SmallInteger() = default;
+
+	/// Checks whether the value is stored inline.
+	bool is_small() const {
+		return !mBig;
+	}
+	/// Returns the inline value, asserts that the value is small.
+	sint small() const {
+		assert(is_small());
+		return mSmall;
+	}
+	/// Returns the promoted value, asserts that the value is not small.
+	const mpz_class& big() const {
+		assert(!is_small());
+		return *mBig;
+	}
+	mpz_class to_mpz() const {
+		return mBig ? *mBig : detail_small::to_mpz(mSmall);
+	}
+	int sgn() const {
+		if (mBig) return mpz_sgn(mBig->get_mpz_t());
+		return (mSmall > 0) - (mSmall < 0);
+	}
+
+	SmallInteger operator-() const {
+		if (!mBig) return SmallInteger(-mSmall);
+		return SmallInteger(mpz_class(-*mBig));
+	}
+	SmallInteger& operator+=(const SmallInteger& rhs) {
+		sint res;
+		if (!mBig && !rhs.mBig && detail_small::add(mSmall, rhs.mSmall, res)) assign(res);
+		else assign(mpz_class(to_mpz() + rhs.to_mpz()));
+		return *this;
+	}
+	SmallInteger& operator-=(const SmallInteger& rhs) {
+		sint res;
+		if (!mBig && !rhs.mBig && detail_small::sub(mSmall, rhs.mSmall, res)) assign(res);
+		else assign(mpz_class(to_mpz() - rhs.to_mpz()));
+		return *this;
+	}
+	SmallInteger& operator*=(const SmallInteger& rhs) {
+		sint res;
+		if (!mBig && !rhs.mBig && detail_small::mul(mSmall, rhs.mSmall, res)) assign(res);
+		else assign(mpz_class(to_mpz() * rhs.to_mpz()));
+		return *this;
+	}
+	/// Truncating division, like for native integers.
+	SmallInteger& operator/=(const SmallInteger& rhs) {
+		assert(rhs.sgn() != 0);
+		if (!mBig && !rhs.mBig) {
+			assign(mSmall / rhs.mSmall);
+		} else {
+			mpz_class res;
+			mpz_tdiv_q(res.get_mpz_t(), to_mpz().get_mpz_t(), rhs.to_mpz().get_mpz_t());
+			assign(std::move(res));
+		}
+		return *this;
+	}
+	/// Remainder of the truncating division, has the sign of the dividend.
+	SmallInteger& operator%=(const SmallInteger& rhs) {
+		assert(rhs.sgn() != 0);
+		if (!mBig && !rhs.mBig) {
+			assign(mSmall % rhs.mSmall);
+		} else {
+			mpz_class res;
+			mpz_tdiv_r(res.get_mpz_t(), to_mpz().get_mpz_t(), rhs.to_mpz().get_mpz_t());
+			assign(std::move(res));
+		}
+		return *this;
+	}
+	SmallInteger& operator++() {
+		return *this += 1;
+	}
+	SmallInteger& operator--() {
+		return *this -= 1;
+	}
+
+	friend SmallInteger operator+(SmallInteger lhs, const SmallInteger& rhs) {
+		return lhs += rhs;
+	}
+	friend SmallInteger operator-(SmallInteger lhs, const SmallInteger& rhs) {
+		return lhs -= rhs;
+	}
+	friend SmallInteger operator*(SmallInteger lhs, const SmallInteger& rhs) {
+		return lhs *= rhs;
+	}
+	friend SmallInteger operator/(SmallInteger lhs, const SmallInteger& rhs) {
+		return lhs /= rhs;
+	}
+	friend SmallInteger operator%(SmallInteger lhs, const SmallInteger& rhs) {
+		return lhs %= rhs;
+	}
+
+	friend bool operator==(const SmallInteger& lhs, const SmallInteger& rhs) {
+		if (!lhs.mBig && !rhs.mBig) return lhs.mSmall == rhs.mSmall;
+		// big values never equal small values
+		if (!lhs.mBig || !rhs.mBig) return false;
+		return *lhs.mBig == *rhs.mBig;
+	}
+	friend bool operator<(const SmallInteger& lhs, const SmallInteger& rhs) {
+		if (!lhs.mBig && !rhs.mBig) return lhs.mSmall < rhs.mSmall;
+		// big values are larger in magnitude than all small values
+		if (!rhs.mBig) return lhs.sgn() < 0;
+		if (!lhs.mBig) return rhs.sgn() > 0;
+		return *lhs.mBig < *rhs.mBig;
+	}
+	friend bool operator!=(const SmallInteger& lhs, const SmallInteger& rhs) {
+		return !(lhs == rhs);
+	}
+	friend bool operator>(const SmallInteger& lhs, const SmallInteger& rhs) {
+		return rhs < lhs;
+	}
+	friend bool operator<=(const SmallInteger& lhs, const SmallInteger& rhs) {
+		return !(rhs < lhs);
+	}
+	friend bool operator>=(const SmallInteger& lhs, const SmallInteger& rhs) {
+		return !(lhs < rhs);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const SmallInteger& n) {
+		if (n.mBig) return os << *n.mBig;
+		return os << n.mSmall;
+	}
+};
+
+/**
+ * An arbitrary precision fraction whose numerator and denominator are stored inline as long as both fit into machine words.
+ *
+ * Like mpq_class, fractions are always canonical, i.e. the denominator is positive and coprime to the numerator.
+ * Fractions that do not fit are promoted to a heap-allocated mpq_class, results that fit again are demoted.
+ * Arithmetic on small fractions uses overflow-checked machine arithmetic and falls back to GMP only on overflow.
+ * @ingroup small
+ */
+class SmallRational {
+	sint mNum = 0;
+	sint mDen = 1;
+	std::unique_ptr<mpq_class> mBig;
+
+	/// Assigns a canonical fraction.
+	void assign(mpq_class&& q) {
+		if (detail_small::fits(q.get_num()) && detail_small::fits(q.get_den())) {
+			mNum = mpz_get_si(q.get_num_mpz_t());
+			mDen = mpz_get_si(q.get_den_mpz_t());
+			mBig.reset();
+		} else if (mBig) {
+			*mBig = std::move(q);
+		} else {
+			mBig = std::make_unique<mpq_class>(std::move(q));
+		}
+	}
+	/// Assigns a canonical fraction.
+	void assign(sint num, sint den) {
+		assert(den > 0 && detail_small::gcd(num, den) == 1);
+		mNum = num;
+		mDen = den;
+		mBig.reset();
+	}
+	/// Assigns num / den for a positive den.
+	void assign_reduce(sint num, sint den) {
+		assert(den > 0);
+		if (num == 0) return assign(0, 1);
+		sint g = detail_small::gcd(num, den);
+		assign(num / g, den / g);
+	}
+
+	static mpq_class make_mpq(const mpz_class& num, const mpz_class& den) {
+		mpq_class res(num, den);
+		res.canonicalize();
+		return res;
+	}
+	static mpq_class make_mpq(const std::string& s) {
+		mpq_class res(s);
+		res.canonicalize();
+		return res;
+	}
+
+	/// Computes lhs + sign * rhs for small fractions.
+	static bool add_small(sint a, sint b, sint c, sint d, SmallRational& res) {
+		if (b == 1 && d == 1) {
+			sint sum;
+			if (!detail_small::add(a, c, sum)) return false;
+			res.assign(sum, 1);
+			return true;
+		}
+		sint g = detail_small::gcd(b, d);
+		sint b1 = b / g;
+		sint d1 = d / g;
+		sint ad, cb, t;
+		if (!detail_small::mul(a, d1, ad) || !detail_small::mul(c, b1, cb) || !detail_small::add(ad, cb, t)) return false;
+		if (t == 0) {
+			res.assign(0, 1);
+			return true;
+		}
+		sint g2 = detail_small::gcd(t, g);
+		sint den;
+		if (!detail_small::mul(b1, d / g2, den)) return false;
+		res.assign(t / g2, den);
+		return true;
+	}
+	/// Computes lhs * rhs for small fractions.
+	static bool mul_small(sint a, sint b, sint c, sint d, SmallRational& res) {
+		if (a == 0 || c == 0) {
+			res.assign(0, 1);
+			return true;
+		}
+		sint g1 = detail_small::gcd(a, d);
+		sint g2 = detail_small::gcd(c, b);
+		sint num, den;
+		if (!detail_small::mul(a / g1, c / g2, num) || !detail_small::mul(b / g2, d / g1, den)) return false;
+		res.assign(num, den);
+		return true;
+	}
+public:
+	SmallRational() = default;
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	SmallRational(T n): SmallRational(SmallInteger(n)) {} // NOLINT
+	SmallRational(const SmallInteger& n) { // NOLINT
+		if (n.is_small()) mNum = n.small();
+		else assign(mpq_class(n.big()));
+	}
+	/// Constructs num / den, asserts that den is not zero.
+	SmallRational(const SmallInteger& num, const SmallInteger& den) {
+		assert(den.sgn() != 0);
+		if (num.is_small() && den.is_small()) {
+			if (den.small() < 0) assign_reduce(-num.small(), -den.small());
+			else assign_reduce(num.small(), den.small());
+		} else {
+			assign(make_mpq(num.to_mpz(), den.to_mpz()));
+		}
+	}
+	explicit SmallRational(const mpq_class& q) {
+		assign(mpq_class(q));
+	}
+	explicit SmallRational(mpq_class&& q) {
+		assign(std::move(q));
+	}
+	explicit SmallRational(const mpz_class& n) {
+		assign(mpq_class(n));
+	}
+	/// Parses a fraction in the form "num/den", like mpq_class.
+	explicit SmallRational(const std::string& s) {
+		assign(make_mpq(s));
+	}
+	explicit SmallRational(const char* s): SmallRational(std::string(s)) {}
+	SmallRational(const SmallRational& q):
+		mNum(q.mNum), mDen(q.mDen), mBig(q.mBig ? std::make_unique<mpq_class>(*q.mBig) : nullptr)
+	{}
+	SmallRational(SmallRational&& q) noexcept = default;
+	SmallRational& operator=(const SmallRational& q) {
+		if (this == &q) return *this;
+		if (!q.mBig) assign(q.mNum, q.mDen);
+		else if (mBig) *mBig = *q.mBig;
+		else mBig = std::make_unique<mpq_class>(*q.mBig);
+		return *this;
+	}
+	SmallRational& operator=(SmallRational&& q) noexcept = default;
+	~SmallRational() = default;
+
+	/// Checks whether numerator and denominator are stored inline.
+	bool is_small() const {
+		return !mBig;
+	}
+	/// Returns the inline numerator, asserts that the value is small.
+	sint small_num() const {
+		assert(is_small());
+		return mNum;
+	}
+	/// Returns the inline denominator, asserts that the value is small.
+	sint small_den() const {
+		assert(is_small());
+		return mDen;
+	}
+	/// Returns the promoted value, asserts that the value is not small.
+	const mpq_class& big() const {
+		assert(!is_small());
+		return *mBig;
+	}
+	mpq_class to_mpq() const {
+		if (mBig) return *mBig;
+		mpq_class res;
+		mpq_set_si(res.get_mpq_t(), static_cast<signed long>(mNum), static_cast<unsigned long>(mDen));
+		return res;
+	}
+	SmallInteger num() const {
+		if (mBig) return SmallInteger(mBig->get_num());
+		return SmallInteger(mNum);
+	}
+	SmallInteger den() const {
+		if (mBig) return SmallInteger(mBig->get_den());
+		return SmallInteger(mDen);
+	}
+	int sgn() const {
+		if (mBig) return mpq_sgn(mBig->get_mpq_t());
+		return (mNum > 0) - (mNum < 0);
+	}
+
+	SmallRational operator-() const {
+		SmallRational res;
+		if (!mBig) res.assign(-mNum, mDen);
+		else res.assign(mpq_class(-*mBig));
+		return res;
+	}
+	SmallRational& operator+=(const SmallRational& rhs) {
+		if (mBig || rhs.mBig || !add_small(mNum, mDen, rhs.mNum, rhs.mDen, *this)) {
+			assign(mpq_class(to_mpq() + rhs.to_mpq()));
+		}
+		return *this;
+	}
+	SmallRational& operator-=(const SmallRational& rhs) {
+		if (mBig || rhs.mBig || !add_small(mNum, mDen, -rhs.mNum, rhs.mDen, *this)) {
+			assign(mpq_class(to_mpq() - rhs.to_mpq()));
+		}
+		return *this;
+	}
+	SmallRational& operator*=(const SmallRational& rhs) {
+		if (mBig || rhs.mBig || !mul_small(mNum, mDen, rhs.mNum, rhs.mDen, *this)) {
+			assign(mpq_class(to_mpq() * rhs.to_mpq()));
+		}
+		return *this;
+	}
+	SmallRational& operator/=(const SmallRational& rhs) {
+		assert(rhs.sgn() != 0);
+		bool done = false;
+		if (!mBig && !rhs.mBig) {
+			if (rhs.mNum < 0) done = mul_small(mNum, mDen, -rhs.mDen, -rhs.mNum, *this);
+			else done = mul_small(mNum, mDen, rhs.mDen, rhs.mNum, *this);
+		}
+		if (!done) assign(mpq_class(to_mpq() / rhs.to_mpq()));
+		return *this;
+	}
+
+	friend SmallRational operator+(SmallRational lhs, const SmallRational& rhs) {
+		return lhs += rhs;
+	}
+	friend SmallRational operator-(SmallRational lhs, const SmallRational& rhs) {
+		return lhs -= rhs;
+	}
+	friend SmallRational operator*(SmallRational lhs, const SmallRational& rhs) {
+		return lhs *= rhs;
+	}
+	friend SmallRational operator/(SmallRational lhs, const SmallRational& rhs) {
+		return lhs /= rhs;
+	}
+
+	friend bool operator==(const SmallRational& lhs, const SmallRational& rhs) {
+		if (!lhs.mBig && !rhs.mBig) return lhs.mNum == rhs.mNum && lhs.mDen == rhs.mDen;
+		// big values never equal small values
+		if (!lhs.mBig || !rhs.mBig) return false;
+		return *lhs.mBig == *rhs.mBig;
+	}
+	friend bool operator<(const SmallRational& lhs, const SmallRational& rhs) {
+		if (!lhs.mBig && !rhs.mBig) {
+			if (lhs.mDen == rhs.mDen) return lhs.mNum < rhs.mNum;
+			sint l, r;
+			if (detail_small::mul(lhs.mNum, rhs.mDen, l) && detail_small::mul(rhs.mNum, lhs.mDen, r)) return l < r;
+		}
+		return lhs.to_mpq() < rhs.to_mpq();
+	}
+	friend bool operator!=(const SmallRational& lhs, const SmallRational& rhs) {
+		return !(lhs == rhs);
+	}
+	friend bool operator>(const SmallRational& lhs, const SmallRational& rhs) {
+		return rhs < lhs;
+	}
+	friend bool operator<=(const SmallRational& lhs, const SmallRational& rhs) {
+		return !(rhs < lhs);
+	}
+	friend bool operator>=(const SmallRational& lhs, const SmallRational& rhs) {
+		return !(lhs < rhs);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const SmallRational& q) {
+		if (q.mBig) return os << *q.mBig;
+		os << q.mNum;
+		if (q.mDen != 1) os << "/" << q.mDen;
+		return os;
+	}
+};
+
+}
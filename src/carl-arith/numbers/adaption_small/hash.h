@@ -0,0 +1,40 @@
+/**
+ * @file    adaption_small/hash.h
+ * @ingroup small
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include <carl-common/util/hash.h>
+#include "../adaption_gmpxx/hash.h"
+#include "SmallNumbers.h"
+
+#include <cstddef>
+#include <functional>
+
+namespace std {
+
+/**
+ * As the representation of every value is unique, small and promoted values can be hashed differently.
+ */
+template<>
+struct hash<carl::SmallInteger> {
+	std::size_t operator()(const carl::SmallInteger& n) const {
+		if (n.is_small()) return std::hash<carl::sint>()(n.small());
+		return std::hash<mpz_class>()(n.big());
+	}
+};
+
+template<>
+struct hash<carl::SmallRational> {
+	std::size_t operator()(const carl::SmallRational& q) const {
+		if (q.is_small()) return carl::hash_all(q.small_num(), q.small_den());
+		return std::hash<mpq_class>()(q.big());
+	}
+};
+
+}
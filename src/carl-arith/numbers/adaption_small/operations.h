@@ -0,0 +1,493 @@
+/**
+ * @file   adaption_small/operations.h
+ * @ingroup small
+ *
+ * Most operations work on the inline representation and fall back to the corresponding operation on gmpxx types for
+ * promoted values.
+ *
+ * @warning This file should never be included directly but only via numbers.h
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../adaption_gmpxx/operations.h"
+#include "SmallNumbers.h"
+#include "typetraits.h"
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace carl {
+
+/**
+ * Informational functions
+ *
+ * The following functions return informations about the given numbers.
+ */
+inline bool is_zero(const SmallInteger& n) {
+	return n.sgn() == 0;
+}
+
+inline bool is_zero(const SmallRational& n) {
+	return n.sgn() == 0;
+}
+
+inline bool is_one(const SmallInteger& n) {
+	return n.is_small() && n.small() == 1;
+}
+
+inline bool is_one(const SmallRational& n) {
+	return n.is_small() && n.small_num() == 1 && n.small_den() == 1;
+}
+
+inline bool is_positive(const SmallInteger& n) {
+	return n.sgn() > 0;
+}
+
+inline bool is_positive(const SmallRational& n) {
+	return n.sgn() > 0;
+}
+
+inline bool is_negative(const SmallInteger& n) {
+	return n.sgn() < 0;
+}
+
+inline bool is_negative(const SmallRational& n) {
+	return n.sgn() < 0;
+}
+
+inline SmallInteger get_num(const SmallRational& n) {
+	return n.num();
+}
+
+inline SmallInteger get_num(const SmallInteger& n) {
+	return n;
+}
+
+inline SmallInteger get_denom(const SmallRational& n) {
+	return n.den();
+}
+
+inline SmallInteger get_denom(const SmallInteger& /*unused*/) {
+	return SmallInteger(1);
+}
+
+inline bool is_integer(const SmallRational& n) {
+	if (n.is_small()) return n.small_den() == 1;
+	return carl::is_integer(n.big());
+}
+
+inline bool is_integer(const SmallInteger& /*unused*/) {
+	return true;
+}
+
+/**
+ * Get the bit size of the representation of a integer.
+ * @param n An integer.
+ * @return Bit size of n.
+ */
+inline std::size_t bitsize(const SmallInteger& n) {
+	if (n.is_small()) return carl::bitsize(mpz_class(static_cast<signed long>(n.small())));
+	return carl::bitsize(n.big());
+}
+/**
+ * Get the bit size of the representation of a fraction.
+ * @param n A fraction.
+ * @return Bit size of n.
+ */
+inline std::size_t bitsize(const SmallRational& n) {
+	return carl::bitsize(n.num()) + carl::bitsize(n.den());
+}
+
+/**
+ * Conversion functions
+ *
+ * The following function convert types to other types.
+ */
+
+inline double to_double(const SmallInteger& n) {
+	if (n.is_small()) return static_cast<double>(n.small());
+	return carl::to_double(n.big());
+}
+inline double to_double(const SmallRational& n) {
+	if (n.is_small()) {
+		// The quotient of two doubles is correctly rounded if both are exact.
+		constexpr sint exact = sint(1) << std::numeric_limits<double>::digits;
+		if (-exact <= n.small_num() && n.small_num() <= exact && n.small_den() <= exact) {
+			return static_cast<double>(n.small_num()) / static_cast<double>(n.small_den());
+		}
+	}
+	return carl::to_double(n.to_mpq());
+}
+
+template<typename Integer>
+inline Integer to_int(const SmallInteger& n);
+
+template<>
+inline sint to_int<sint>(const SmallInteger& n) {
+	if (n.is_small()) return n.small();
+	return to_int<sint>(n.big());
+}
+template<>
+inline uint to_int<uint>(const SmallInteger& n) {
+	if (n.is_small()) {
+		assert(n.small() >= 0);
+		return uint(n.small());
+	}
+	return to_int<uint>(n.big());
+}
+
+template<typename Integer>
+inline Integer to_int(const SmallRational& n);
+
+/**
+ * Convert a fraction to an integer.
+ * This method assert, that the given fraction is an integer, i.e. that the denominator is one.
+ * @param n A fraction.
+ * @return An integer.
+ */
+template<>
+inline SmallInteger to_int<SmallInteger>(const SmallRational& n) {
+	assert(is_integer(n));
+	return n.num();
+}
+template<>
+inline sint to_int<sint>(const SmallRational& n) {
+	return to_int<sint>(to_int<SmallInteger>(n));
+}
+template<>
+inline uint to_int<uint>(const SmallRational& n) {
+	return to_int<uint>(to_int<SmallInteger>(n));
+}
+
+template<>
+inline SmallInteger from_int(const uint& n) {
+	return SmallInteger(n);
+}
+template<>
+inline SmallInteger from_int(const sint& n) {
+	return SmallInteger(n);
+}
+template<>
+inline SmallRational from_int(const uint& n) {
+	return SmallRational(n);
+}
+template<>
+inline SmallRational from_int(const sint& n) {
+	return SmallRational(n);
+}
+
+template<>
+inline SmallRational rationalize<SmallRational>(float n) {
+	return SmallRational(rationalize<mpq_class>(n));
+}
+template<>
+inline SmallRational rationalize<SmallRational>(double n) {
+	return SmallRational(rationalize<mpq_class>(n));
+}
+template<>
+inline SmallRational rationalize<SmallRational>(int n) {
+	return SmallRational(n);
+}
+template<>
+inline SmallRational rationalize<SmallRational>(uint n) {
+	return SmallRational(n);
+}
+template<>
+inline SmallRational rationalize<SmallRational>(sint n) {
+	return SmallRational(n);
+}
+
+template<>
+inline SmallInteger parse<SmallInteger>(const std::string& n) {
+	return SmallInteger(parse<mpz_class>(n));
+}
+template<>
+inline bool try_parse<SmallInteger>(const std::string& n, SmallInteger& res) {
+	mpz_class tmp;
+	if (!try_parse<mpz_class>(n, tmp)) return false;
+	res = SmallInteger(std::move(tmp));
+	return true;
+}
+template<>
+inline SmallRational parse<SmallRational>(const std::string& n) {
+	return SmallRational(parse<mpq_class>(n));
+}
+template<>
+inline bool try_parse<SmallRational>(const std::string& n, SmallRational& res) {
+	mpq_class tmp;
+	if (!try_parse<mpq_class>(n, tmp)) return false;
+	res = SmallRational(std::move(tmp));
+	return true;
+}
+
+/**
+ * Basic Operators
+ *
+ * The following functions implement simple operations on the given numbers.
+ */
+
+inline SmallInteger abs(const SmallInteger& n) {
+	return n.sgn() < 0 ? -n : n;
+}
+
+inline SmallRational abs(const SmallRational& n) {
+	return n.sgn() < 0 ? -n : n;
+}
+
+inline SmallInteger floor(const SmallRational& n) {
+	if (!n.is_small()) return SmallInteger(carl::floor(n.big()));
+	sint q = n.small_num() / n.small_den();
+	if (n.small_num() % n.small_den() < 0) --q;
+	return SmallInteger(q);
+}
+
+inline SmallInteger floor(const SmallInteger& n) {
+	return n;
+}
+
+inline SmallInteger ceil(const SmallRational& n) {
+	if (!n.is_small()) return SmallInteger(carl::ceil(n.big()));
+	sint q = n.small_num() / n.small_den();
+	if (n.small_num() % n.small_den() > 0) ++q;
+	return SmallInteger(q);
+}
+
+inline SmallInteger ceil(const SmallInteger& n) {
+	return n;
+}
+
+/**
+ * Rounds to the nearest integer, halves are rounded up.
+ */
+inline SmallInteger round(const SmallRational& n) {
+	if (!n.is_small()) return SmallInteger(carl::round(n.big()));
+	sint den = n.small_den();
+	sint q = n.small_num() / den;
+	sint r = n.small_num() % den;
+	if (r < 0) {
+		--q;
+		r += den;
+	}
+	if (r >= den - r) ++q;
+	return SmallInteger(q);
+}
+
+inline SmallInteger round(const SmallInteger& n) {
+	return n;
+}
+
+inline SmallInteger gcd(const SmallInteger& a, const SmallInteger& b) {
+	if (a.is_small() && b.is_small()) return SmallInteger(detail_small::gcd(a.small(), b.small()));
+	return SmallInteger(carl::gcd(a.to_mpz(), b.to_mpz()));
+}
+
+inline SmallInteger lcm(const SmallInteger& a, const SmallInteger& b) {
+	if (a.is_small() && b.is_small()) {
+		if (a.small() == 0 || b.small() == 0) return SmallInteger(0);
+		sint res;
+		if (detail_small::mul(std::abs(a.small() / detail_small::gcd(a.small(), b.small())), std::abs(b.small()), res)) {
+			return SmallInteger(res);
+		}
+	}
+	return SmallInteger(carl::lcm(a.to_mpz(), b.to_mpz()));
+}
+
+/**
+ * Calculate the greatest common divisor of two fractions, that is the gcd of the numerators divided by the lcm of the denominators.
+ */
+inline SmallRational gcd(const SmallRational& a, const SmallRational& b) {
+	return SmallRational(carl::gcd(a.num(), b.num()), carl::lcm(a.den(), b.den()));
+}
+
+/**
+ * Calculate the least common multiple of two fractions, that is the lcm of the numerators divided by the gcd of the denominators.
+ */
+inline SmallRational lcm(const SmallRational& a, const SmallRational& b) {
+	return SmallRational(carl::lcm(a.num(), b.num()), carl::gcd(a.den(), b.den()));
+}
+
+/**
+ * Calculate the greatest common divisor of two integers.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline SmallInteger& gcd_assign(SmallInteger& a, const SmallInteger& b) {
+	a = carl::gcd(a, b);
+	return a;
+}
+
+/**
+ * Calculate the greatest common divisor of two fractions.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline SmallRational& gcd_assign(SmallRational& a, const SmallRational& b) {
+	a = carl::gcd(a, b);
+	return a;
+}
+
+inline SmallRational log(const SmallRational& n) {
+	return carl::rationalize<SmallRational>(std::log(carl::to_double(n)));
+}
+inline SmallRational log10(const SmallRational& n) {
+	return carl::rationalize<SmallRational>(std::log10(carl::to_double(n)));
+}
+
+inline SmallRational sin(const SmallRational& n) {
+	return carl::rationalize<SmallRational>(std::sin(carl::to_double(n)));
+}
+
+inline SmallRational cos(const SmallRational& n) {
+	return carl::rationalize<SmallRational>(std::cos(carl::to_double(n)));
+}
+
+/**
+ * Calculate the square root of a fraction if possible.
+ *
+ * @param a The fraction to calculate the square root for.
+ * @param b A reference to the rational, in which the result is stored.
+ * @return true, if the number to calculate the square root for is a square;
+ *         false, otherwise.
+ */
+inline bool sqrt_exact(const SmallRational& a, SmallRational& b) {
+	mpq_class res;
+	if (!carl::sqrt_exact(a.to_mpq(), res)) return false;
+	b = SmallRational(std::move(res));
+	return true;
+}
+
+inline SmallRational sqrt(const SmallRational& a) {
+	return SmallRational(carl::sqrt(a.to_mpq()));
+}
+
+inline std::pair<SmallRational, SmallRational> sqrt_safe(const SmallRational& a) {
+	auto res = carl::sqrt_safe(a.to_mpq());
+	return std::make_pair(SmallRational(std::move(res.first)), SmallRational(std::move(res.second)));
+}
+
+/**
+ * Calculate the nth root of a fraction.
+ * The precise result is contained in the resulting interval.
+ */
+inline std::pair<SmallRational, SmallRational> root_safe(const SmallRational& a, uint n) {
+	auto res = carl::root_safe(a.to_mpq(), n);
+	return std::make_pair(SmallRational(std::move(res.first)), SmallRational(std::move(res.second)));
+}
+
+inline std::pair<SmallRational, SmallRational> sqrt_fast(const SmallRational& a) {
+	auto res = carl::sqrt_fast(a.to_mpq());
+	return std::make_pair(SmallRational(std::move(res.first)), SmallRational(std::move(res.second)));
+}
+
+/**
+ * Calculate the remainder of an integer division, which has the sign of n like for native integers.
+ */
+inline SmallInteger mod(const SmallInteger& n, const SmallInteger& m) {
+	return n % m;
+}
+
+inline SmallInteger remainder(const SmallInteger& n, const SmallInteger& m) {
+	return n % m;
+}
+
+/**
+ * Calculate the quotient of an integer division, which is rounded towards zero like for native integers.
+ */
+inline SmallInteger quotient(const SmallInteger& n, const SmallInteger& d) {
+	return n / d;
+}
+
+inline SmallRational quotient(const SmallRational& n, const SmallRational& d) {
+	return n / d;
+}
+
+inline void divide(const SmallInteger& dividend, const SmallInteger& divisor, SmallInteger& quotient, SmallInteger& remainder) {
+	if (dividend.is_small() && divisor.is_small()) {
+		// floor division like mpz_divmod
+		sint q = dividend.small() / divisor.small();
+		sint r = dividend.small() % divisor.small();
+		if (r != 0 && ((r < 0) != (divisor.small() < 0))) {
+			--q;
+			r += divisor.small();
+		}
+		quotient = SmallInteger(q);
+		remainder = SmallInteger(r);
+		return;
+	}
+	mpz_class q;
+	mpz_class r;
+	carl::divide(dividend.to_mpz(), divisor.to_mpz(), q, r);
+	quotient = SmallInteger(std::move(q));
+	remainder = SmallInteger(std::move(r));
+}
+
+/**
+ * Divide two fractions.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline SmallRational div(const SmallRational& a, const SmallRational& b) {
+	return a / b;
+}
+
+/**
+ * Divide two integers.
+ * Asserts that the remainder is zero.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline SmallInteger div(const SmallInteger& a, const SmallInteger& b) {
+	assert(carl::is_zero(carl::mod(a, b)));
+	return a / b;
+}
+
+/**
+ * Divide two integers.
+ * Asserts that the remainder is zero.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline SmallInteger& div_assign(SmallInteger& a, const SmallInteger& b) {
+	assert(carl::is_zero(carl::mod(a, b)));
+	return a /= b;
+}
+
+/**
+ * Divide two fractions.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline SmallRational& div_assign(SmallRational& a, const SmallRational& b) {
+	return a /= b;
+}
+
+inline SmallRational reciprocal(const SmallRational& a) {
+	return SmallRational(a.den(), a.num());
+}
+
+inline std::string toString(const SmallRational& _number, bool _infix=true) {
+	return carl::toString(_number.to_mpq(), _infix);
+}
+
+inline std::string toString(const SmallInteger& _number, bool _infix=true) {
+	return carl::toString(_number.to_mpz(), _infix);
+}
+
+}
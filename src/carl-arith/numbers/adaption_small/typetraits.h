@@ -0,0 +1,24 @@
+/**
+ * @file   adaption_small/typetraits.h
+ * @ingroup typetraits
+ * @ingroup small
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../typetraits.h"
+#include "SmallNumbers.h"
+
+namespace carl {
+
+TRAIT_TRUE(is_integer_type, SmallInteger, small);
+TRAIT_TRUE(is_rational_type, SmallRational, small);
+
+TRAIT_TYPE(IntegralType, SmallRational, SmallInteger, small);
+TRAIT_TYPE(IntegralType, SmallInteger, SmallInteger, small);
+
+}
@@ -13,3 +13,4 @@ namespace carl {
 #include "cln_gmp.h"
 #include "generic.h"
 #include "native.h"
+#include "small_gmp.h"
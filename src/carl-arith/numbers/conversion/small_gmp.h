@@ -0,0 +1,45 @@
+#pragma once
+
+namespace carl {
+
+	template<>
+	inline mpz_class convert<SmallInteger, mpz_class>(const SmallInteger& n) {
+		return n.to_mpz();
+	}
+
+	template<>
+	inline SmallInteger convert<mpz_class, SmallInteger>(const mpz_class& n) {
+		return SmallInteger(n);
+	}
+
+	template<>
+	inline mpq_class convert<SmallRational, mpq_class>(const SmallRational& n) {
+		return n.to_mpq();
+	}
+
+	template<>
+	inline SmallRational convert<mpq_class, SmallRational>(const mpq_class& n) {
+		return SmallRational(n);
+	}
+
+	template<>
+	inline mpq_class convert<SmallInteger, mpq_class>(const SmallInteger& n) {
+		return mpq_class(n.to_mpz());
+	}
+
+	template<>
+	inline SmallRational convert<mpz_class, SmallRational>(const mpz_class& n) {
+		return SmallRational(n);
+	}
+
+	template<>
+	inline double convert<SmallRational, double>(const SmallRational& n) {
+		return carl::to_double(n);
+	}
+
+	template<>
+	inline SmallRational convert<double, SmallRational>(const double& n) {
+		return carl::rationalize<SmallRational>(n);
+	}
+
+}
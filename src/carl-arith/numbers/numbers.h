@@ -33,6 +33,10 @@ namespace carl {
 #include "adaption_gmpxx/operations.h"
 #include "adaption_gmpxx/typetraits.h"
 
+#include "adaption_small/hash.h"
+#include "adaption_small/operations.h"
+#include "adaption_small/typetraits.h"
+
 
 #ifdef USE_CLN_NUMBERS
 #include "adaption_cln/include.h"
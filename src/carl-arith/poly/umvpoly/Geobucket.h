@@ -0,0 +1,258 @@
+/**
+ * @file Geobucket.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "Term.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A geobucket accumulates a sum of (scaled) polynomials and allows to extract its leading terms.
+ *
+ * The sum is distributed over buckets of geometrically growing capacity, where bucket i holds at most
+ * base_capacity * 4^i terms.
+ * Every bucket is a fully ordered vector of terms with the largest term at the back.
+ * Adding a polynomial merges it only into the smallest bucket that can hold it.
+ * A bucket is merged into the next one only if it overflows, hence the merging cost is amortized over many additions.
+ * Leading terms are computed lazily: the bucket leaders with the largest monomial are summed up in place
+ * and the result is cached until the geobucket is modified.
+ *
+ * This is the usual data structure to reduce a single polynomial by many other polynomials, as it avoids
+ * creating a new polynomial for every reduction step.
+ * @see @cite Yan98
+ * @ingroup multirp
+ */
+template<typename Polynomial>
+class Geobucket {
+public:
+	using Coeff = typename Polynomial::CoeffType;
+	using Ordering = typename Polynomial::OrderedBy;
+	using TermType = Term<Coeff>;
+private:
+	using Bucket = std::vector<TermType>;
+	static constexpr std::size_t base_capacity = 4;
+	static constexpr std::size_t no_lead = std::size_t(-1);
+
+	/// The buckets, each ordered ascendingly. Mutable, as leading terms are combined lazily.
+	mutable std::vector<Bucket> mBuckets;
+	/// Scratch space for the terms that are added.
+	Bucket mInput;
+	/// Scratch space for merging buckets.
+	Bucket mMerged;
+	/// Bucket that holds the combined leading term at its back, no_lead if not yet computed.
+	mutable std::size_t mLead = no_lead;
+
+	static std::size_t capacity(std::size_t bucket) {
+		return base_capacity << (2 * bucket);
+	}
+
+	/**
+	 * Merges the ascendingly ordered terms of a and b into res.
+	 * Terms with equal monomials are combined, vanishing terms are dropped.
+	 */
+	static void merge(const Bucket& a, const Bucket& b, Bucket& res) {
+		res.clear();
+		res.reserve(a.size() + b.size());
+		auto ita = a.begin();
+		auto itb = b.begin();
+		while (ita != a.end() && itb != b.end()) {
+			switch (Ordering::compare(*ita, *itb)) {
+				case CompareResult::LESS:
+					res.push_back(*ita++);
+					break;
+				case CompareResult::GREATER:
+					res.push_back(*itb++);
+					break;
+				case CompareResult::EQUAL: {
+					Coeff c = ita->coeff() + itb->coeff();
+					if (!carl::is_zero(c)) {
+						res.emplace_back(std::move(c), ita->monomial());
+					}
+					++ita;
+					++itb;
+					break;
+				}
+			}
+		}
+		res.insert(res.end(), ita, a.end());
+		res.insert(res.end(), itb, b.end());
+	}
+
+	/**
+	 * Merges mInput into the buckets, starting with the smallest bucket that can hold it.
+	 */
+	void insert_input() {
+		if (mInput.empty()) return;
+		std::size_t bucket = 0;
+		while (capacity(bucket) < mInput.size()) ++bucket;
+		while (true) {
+			if (bucket >= mBuckets.size()) mBuckets.resize(bucket + 1);
+			merge(mBuckets[bucket], mInput, mMerged);
+			mInput.clear();
+			if (mMerged.size() <= capacity(bucket)) {
+				std::swap(mBuckets[bucket], mMerged);
+				break;
+			}
+			// The bucket overflows, push its content to the next bucket.
+			std::swap(mInput, mMerged);
+			mBuckets[bucket].clear();
+			++bucket;
+		}
+		mLead = no_lead;
+	}
+
+	/**
+	 * Computes the leading term by combining the leaders of all buckets.
+	 * @return If the geobucket is nonzero.
+	 */
+	bool find_lead() const {
+		if (mLead != no_lead) return true;
+		while (true) {
+			std::size_t lead = no_lead;
+			for (std::size_t i = 0; i < mBuckets.size(); ++i) {
+				if (mBuckets[i].empty()) continue;
+				if (lead == no_lead || Ordering::less(mBuckets[lead].back(), mBuckets[i].back())) {
+					lead = i;
+				}
+			}
+			if (lead == no_lead) return false;
+			// Sum up all leaders with the same monomial within the leading bucket.
+			for (std::size_t i = 0; i < mBuckets.size(); ++i) {
+				if (i == lead || mBuckets[i].empty()) continue;
+				if (TermType::monomialEqual(mBuckets[i].back(), mBuckets[lead].back())) {
+					mBuckets[lead].back().coeff() += mBuckets[i].back().coeff();
+					mBuckets[i].pop_back();
+				}
+			}
+			if (!carl::is_zero(mBuckets[lead].back().coeff())) {
+				mLead = lead;
+				return true;
+			}
+			mBuckets[lead].pop_back();
+		}
+	}
+
+	/**
+	 * Copies factor * (p without its skip largest terms) into mInput, ordered ascendingly.
+	 */
+	template<typename Poly>
+	void prepare_input(const TermType& factor, const Poly& p, std::size_t skip) {
+		mInput.clear();
+		if (carl::is_zero(factor) || p.nr_terms() <= skip) return;
+		mInput.reserve(p.nr_terms() - skip);
+		if (p.isOrdered()) {
+			for (auto it = p.begin(); it != p.end() - long(skip); ++it) {
+				mInput.push_back(factor * *it);
+			}
+		} else {
+			for (const auto& t: p) {
+				mInput.push_back(factor * t);
+			}
+			std::sort(mInput.begin(), mInput.end(),
+				[](const auto& lhs, const auto& rhs){ return Ordering::less(lhs, rhs); }
+			);
+			mInput.resize(mInput.size() - skip);
+		}
+	}
+public:
+	Geobucket() = default;
+
+	explicit Geobucket(const Polynomial& p) {
+		add(p);
+	}
+
+	/**
+	 * Adds a polynomial.
+	 * @param p Polynomial.
+	 */
+	template<typename Poly>
+	void add(const Poly& p) {
+		add(TermType(constant_one<Coeff>::get()), p);
+	}
+
+	/**
+	 * Adds factor * p, ignoring the skip largest terms of p.
+	 * Passing skip = 1 allows to add the tail of a reductor without constructing it explicitly.
+	 * @param factor Factor.
+	 * @param p Polynomial.
+	 * @param skip Number of leading terms of p to ignore.
+	 */
+	template<typename Poly>
+	void add(const TermType& factor, const Poly& p, std::size_t skip = 0) {
+		prepare_input(factor, p, skip);
+		insert_input();
+	}
+
+	/**
+	 * Adds a single term.
+	 * @param t Term.
+	 */
+	void add(const TermType& t) {
+		if (carl::is_zero(t)) return;
+		mInput.clear();
+		mInput.push_back(t);
+		insert_input();
+	}
+
+	/**
+	 * @return If the accumulated sum is zero.
+	 */
+	bool empty() const {
+		return !find_lead();
+	}
+
+	/**
+	 * Returns the leading term of the accumulated sum.
+	 * Notice that this is not defined if the sum is zero.
+	 * @return Leading term.
+	 */
+	const TermType& lterm() const {
+		bool nonzero = find_lead();
+		assert(nonzero);
+		(void)nonzero;
+		return mBuckets[mLead].back();
+	}
+
+	/**
+	 * Removes the leading term of the accumulated sum.
+	 */
+	void strip_lterm() {
+		bool nonzero = find_lead();
+		assert(nonzero);
+		(void)nonzero;
+		mBuckets[mLead].pop_back();
+		mLead = no_lead;
+	}
+
+	/**
+	 * Removes all terms.
+	 */
+	void clear() {
+		mBuckets.clear();
+		mLead = no_lead;
+	}
+
+	/**
+	 * Collects all buckets into a single polynomial.
+	 * The geobucket is empty afterwards.
+	 * @return The accumulated sum.
+	 */
+	Polynomial to_polynomial() {
+		Bucket res;
+		for (auto& b: mBuckets) {
+			merge(res, b, mMerged);
+			std::swap(res, mMerged);
+		}
+		clear();
+		return Polynomial(std::move(res), false, true);
+	}
+};
+
+}
@@ -0,0 +1,421 @@
+/**
+ * @file AberthEhrlich.h
+ * @ingroup upoly
+ */
+
+#pragma once
+
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/numbers/numbers.h>
+#include <carl-logging/carl-logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace carl {
+namespace roots {
+namespace aberth {
+
+/**
+ * Floating-point types for the approximation.
+ * Every value is created with an explicit precision, the iteration only uses compound assignments that keep this precision.
+ */
+template<typename Float>
+struct float_traits;
+
+template<>
+struct float_traits<mpf_class> {
+	static mpf_class from_rational(const mpq_class& n, std::size_t precision) {
+		return mpf_class(n, precision);
+	}
+	static mpf_class from_double(double d, std::size_t precision) {
+		return mpf_class(d, precision);
+	}
+	static mpq_class to_rational(const mpf_class& f) {
+		return mpq_class(f);
+	}
+};
+
+#ifdef USE_MPFR_FLOAT
+template<>
+struct float_traits<FLOAT_T<mpfr_t>> {
+	static FLOAT_T<mpfr_t> from_rational(const mpq_class& n, std::size_t precision) {
+		mpfr_t tmp;
+		mpfr_init2(tmp, mpfr_prec_t(precision));
+		mpfr_set_q(tmp, n.get_mpq_t(), MPFR_RNDN);
+		FLOAT_T<mpfr_t> res(tmp);
+		mpfr_clear(tmp);
+		return res;
+	}
+	static FLOAT_T<mpfr_t> from_double(double d, std::size_t precision) {
+		return FLOAT_T<mpfr_t>(d, CARL_RND::N, precision);
+	}
+	static mpq_class to_rational(const FLOAT_T<mpfr_t>& f) {
+		mpq_class res;
+		mpfr_get_q(res.get_mpq_t(), f.value());
+		return res;
+	}
+};
+
+/// Floating-point type used by default.
+using DefaultFloat = FLOAT_T<mpfr_t>;
+#else
+/// Floating-point type used by default, GMP floats if carl is built without MPFR.
+using DefaultFloat = mpf_class;
+#endif
+
+/**
+ * Complex numbers on an arbitrary floating-point type.
+ * std::complex is only specified for the builtin floating-point types.
+ */
+template<typename T>
+struct Complex {
+	T re;
+	T im;
+
+	Complex& operator+=(const Complex& rhs) {
+		re += rhs.re;
+		im += rhs.im;
+		return *this;
+	}
+	Complex& operator-=(const Complex& rhs) {
+		re -= rhs.re;
+		im -= rhs.im;
+		return *this;
+	}
+	Complex& operator*=(const Complex& rhs) {
+		T t = im;
+		t *= rhs.im;
+		T i = re;
+		i *= rhs.im;
+		re *= rhs.re;
+		re -= t;
+		t = im;
+		t *= rhs.re;
+		im = i;
+		im += t;
+		return *this;
+	}
+	Complex& operator/=(const Complex& rhs) {
+		T den = rhs.norm();
+		// Multiply by the conjugate of rhs.
+		T t = im;
+		t *= rhs.im;
+		T i = im;
+		i *= rhs.re;
+		T u = re;
+		u *= rhs.im;
+		re *= rhs.re;
+		re += t;
+		im = i;
+		im -= u;
+		re /= den;
+		im /= den;
+		return *this;
+	}
+	/// Squared absolute value.
+	T norm() const {
+		T res = re;
+		res *= re;
+		T t = im;
+		t *= im;
+		res += t;
+		return res;
+	}
+};
+
+/**
+ * Computes p(z) and p'(z) by Horner's scheme.
+ */
+template<typename T>
+std::pair<Complex<T>,Complex<T>> evaluate_with_derivative(const std::vector<T>& coeffs, const Complex<T>& z, const T& zero) {
+	Complex<T> val{coeffs.back(), zero};
+	Complex<T> der{zero, zero};
+	for (std::size_t i = coeffs.size() - 1; i > 0; --i) {
+		der *= z;
+		der += val;
+		val *= z;
+		val.re += coeffs[i - 1];
+	}
+	return std::make_pair(val, der);
+}
+
+/// Approximates log2(|n|) for n != 0.
+inline double log2_abs(const mpz_class& n) {
+	long exp;
+	double d = mpz_get_d_2exp(&exp, n.get_mpz_t());
+	return std::log2(std::abs(d)) + static_cast<double>(exp);
+}
+
+/**
+ * Simultaneous approximation of all complex roots of a square-free polynomial by the Aberth-Ehrlich iteration.
+ *
+ * Every step updates all approximations by z_k -= w_k / (1 - w_k * sum_{j != k} 1/(z_k - z_j)) with w_k = p(z_k) / p'(z_k).
+ * The initial approximations are placed on a circle whose radius is the geometric mean of the absolute values of the roots.
+ * @see @cite BF00
+ * @param coeffs Coefficients, starting with the constant coefficient.
+ * @param precision Precision in bits.
+ * @param approximations Initial approximations, e.g. from a previous call with lower precision, or empty.
+ * @return Approximations of the roots and whether the iteration converged.
+ */
+template<typename Float = DefaultFloat>
+std::pair<std::vector<Complex<Float>>,bool> root_approximation(const std::vector<mpz_class>& coeffs, std::size_t precision, const std::vector<Complex<mpq_class>>& approximations = {}) {
+	using traits = float_traits<Float>;
+	assert(coeffs.size() > 1 && carl::is_zero(coeffs.back()) == false && carl::is_zero(coeffs.front()) == false);
+	std::size_t degree = coeffs.size() - 1;
+	const Float zero = traits::from_double(0, precision);
+	const Float one = traits::from_double(1, precision);
+	std::vector<Float> p;
+	for (const auto& c: coeffs) {
+		p.emplace_back(traits::from_rational(mpq_class(c), precision));
+	}
+
+	std::vector<Complex<Float>> z;
+	if (approximations.size() == degree) {
+		for (const auto& a: approximations) {
+			z.push_back(Complex<Float>{traits::from_rational(a.re, precision), traits::from_rational(a.im, precision)});
+		}
+	} else {
+		double log_radius = (log2_abs(coeffs.front()) - log2_abs(coeffs.back())) / static_cast<double>(degree);
+		long exp = std::lround(log_radius);
+		mpq_class radius = exp >= 0 ? mpq_class(carl::pow(mpz_class(2), std::size_t(exp))) : mpq_class(1, carl::pow(mpz_class(2), std::size_t(-exp)));
+		// The offset avoids symmetries with respect to the real axis.
+		const double pi = std::acos(-1.0);
+		for (std::size_t k = 0; k < degree; ++k) {
+			double angle = 2 * pi * static_cast<double>(k) / static_cast<double>(degree) + 0.4;
+			Complex<Float> zk{traits::from_double(std::cos(angle), precision), traits::from_double(std::sin(angle), precision)};
+			Float r = traits::from_rational(radius, precision);
+			zk.re *= r;
+			zk.im *= r;
+			z.push_back(zk);
+		}
+	}
+
+	// An approximation has converged if its correction is below 2^-(precision/2) relative to the approximation.
+	// Converged approximations are not updated any more, the remaining precision is left for the certification.
+	Float eps = traits::from_rational(mpq_class(1, carl::pow(mpz_class(2), precision / 2)), precision);
+	eps *= eps;
+	std::vector<bool> converged(degree, false);
+	std::size_t remaining = degree;
+	std::size_t max_iterations = 50 + 2 * degree;
+	for (std::size_t iteration = 0; iteration < max_iterations; ++iteration) {
+		for (std::size_t k = 0; k < degree; ++k) {
+			if (converged[k]) continue;
+			auto [val, der] = evaluate_with_derivative(p, z[k], zero);
+			if (val.re == zero && val.im == zero) {
+				converged[k] = true;
+				--remaining;
+				continue;
+			}
+			if (der.re == zero && der.im == zero) return std::make_pair(z, false);
+			Complex<Float> w = val;
+			w /= der;
+			Complex<Float> sum{zero, zero};
+			for (std::size_t j = 0; j < degree; ++j) {
+				if (j == k) continue;
+				Complex<Float> diff = z[k];
+				diff -= z[j];
+				if (diff.re == zero && diff.im == zero) return std::make_pair(z, false);
+				Complex<Float> inv{one, zero};
+				inv /= diff;
+				sum += inv;
+			}
+			Complex<Float> den{one, zero};
+			sum *= w;
+			den -= sum;
+			if (den.re == zero && den.im == zero) return std::make_pair(z, false);
+			w /= den;
+			z[k] -= w;
+			Float bound = z[k].norm();
+			bound += one;
+			bound *= eps;
+			if (!(bound < w.norm())) {
+				converged[k] = true;
+				--remaining;
+			}
+		}
+		if (remaining == 0) {
+			CARL_LOG_DEBUG("carl.roots.aberth", "Converged after " << iteration + 1 << " iterations with precision " << precision);
+			return std::make_pair(z, true);
+		}
+	}
+	CARL_LOG_DEBUG("carl.roots.aberth", "No convergence with precision " << precision);
+	return std::make_pair(z, false);
+}
+
+/**
+ * Computes a rational upper bound on the square root of a nonnegative rational.
+ */
+inline mpq_class sqrt_upper_bound(const mpq_class& n, std::size_t precision) {
+	if (carl::is_zero(n)) return n;
+	mpf_class approx = sqrt(mpf_class(n, precision));
+	mpq_class res(approx);
+	res *= mpq_class(1025, 1024);
+	while (res * res < n) {
+		res *= 2;
+	}
+	return res;
+}
+
+/**
+ * Certifies approximations of all complex roots of a square-free polynomial and extracts isolating intervals for the real roots.
+ *
+ * The disks around z_k with radius r_k = n * |p(z_k) / (lc(p) * prod_{j != k} (z_k - z_j))| contain all roots,
+ * and every connected component of m disks contains exactly m roots.
+ * If the disks are pairwise disjoint, each disk contains a single root. A disk centered on the real axis then contains a real root,
+ * as the conjugate of the root is contained in the same disk, and a disk that does not intersect the real axis a non-real root.
+ * All computations are exact.
+ * @param coeffs Coefficients, starting with the constant coefficient.
+ * @param approximations Dyadic approximations of all roots, real roots with zero imaginary part.
+ * @return Isolating intervals of all real roots (point intervals for rational roots) in ascending order, or nothing if certification failed.
+ */
+inline std::optional<std::vector<Interval<mpq_class>>> certify(const std::vector<mpz_class>& coeffs, const std::vector<Complex<mpq_class>>& approximations, std::size_t precision) {
+	std::size_t degree = coeffs.size() - 1;
+	assert(approximations.size() == degree);
+	// The approximations are dyadic, we compute on integers Z_k = z_k * 2^scale to avoid canonicalizing rationals.
+	std::size_t scale = 0;
+	for (const auto& z: approximations) {
+		scale = std::max({scale, carl::bitsize(z.re.get_den()) - 1, carl::bitsize(z.im.get_den()) - 1});
+	}
+	std::vector<Complex<mpz_class>> scaled;
+	for (const auto& z: approximations) {
+		assert(mpz_scan1(z.re.get_den_mpz_t(), 0) + 1 == carl::bitsize(z.re.get_den()) && mpz_scan1(z.im.get_den_mpz_t(), 0) + 1 == carl::bitsize(z.im.get_den()));
+		scaled.push_back(Complex<mpz_class>{
+			mpz_class(z.re * mpq_class(mpz_class(1) << scale)),
+			mpz_class(z.im * mpq_class(mpz_class(1) << scale))
+		});
+	}
+	std::vector<mpq_class> radii;
+	for (std::size_t k = 0; k < degree; ++k) {
+		const auto& z = scaled[k];
+		// val = p(z_k) * 2^(scale * degree)
+		Complex<mpz_class> val{coeffs.back(), mpz_class(0)};
+		for (std::size_t i = degree; i > 0; --i) {
+			val *= z;
+			val.re += coeffs[i - 1] << (scale * (degree - i + 1));
+		}
+		if (carl::is_zero(val.re) && carl::is_zero(val.im)) {
+			radii.emplace_back(0);
+			continue;
+		}
+		// den = lc(p) * prod_{j != k} (z_k - z_j) * 2^(scale * (degree - 1))
+		Complex<mpz_class> den{coeffs.back(), mpz_class(0)};
+		for (std::size_t j = 0; j < degree; ++j) {
+			if (j == k) continue;
+			Complex<mpz_class> diff = z;
+			diff -= scaled[j];
+			den *= diff;
+		}
+		mpz_class den_norm = den.norm();
+		if (carl::is_zero(den_norm)) return std::nullopt;
+		mpz_class num_norm = val.norm() * (degree * degree);
+		radii.emplace_back(sqrt_upper_bound(mpq_class(num_norm, den_norm << (2 * scale)), precision));
+	}
+	for (std::size_t k = 0; k < degree; ++k) {
+		const auto& zk = approximations[k];
+		if (!carl::is_zero(zk.im) && zk.im * zk.im <= radii[k] * radii[k]) {
+			CARL_LOG_DEBUG("carl.roots.aberth", "Disk around " << zk.re << " + " << zk.im << "i intersects the real axis");
+			return std::nullopt;
+		}
+		for (std::size_t j = k + 1; j < degree; ++j) {
+			Complex<mpq_class> diff = zk;
+			diff -= approximations[j];
+			mpq_class sum = radii[k] + radii[j];
+			if (diff.norm() <= sum * sum) {
+				CARL_LOG_DEBUG("carl.roots.aberth", "Disks around roots " << k << " and " << j << " overlap");
+				return std::nullopt;
+			}
+		}
+	}
+	auto sign_at = [&coeffs](const mpq_class& x) {
+		mpq_class res(coeffs.back());
+		for (std::size_t i = coeffs.size() - 1; i > 0; --i) {
+			res = res * x + coeffs[i - 1];
+		}
+		return carl::sgn(res);
+	};
+	// Real roots as center and radius, in ascending order.
+	std::vector<std::pair<mpq_class,mpq_class>> real;
+	for (std::size_t k = 0; k < degree; ++k) {
+		if (carl::is_zero(approximations[k].im)) {
+			real.emplace_back(approximations[k].re, radii[k]);
+		}
+	}
+	std::sort(real.begin(), real.end());
+	// Real points outside of all disks are no roots. Hence the bounds c-r and c+r are moved outwards to the next multiple
+	// of a power of two that is at most r, as long as they do not reach the neighbouring intervals.
+	// This keeps the bit size of the bounds proportional to the accuracy instead of the working precision.
+	std::vector<Interval<mpq_class>> res;
+	for (std::size_t k = 0; k < real.size(); ++k) {
+		const auto& [center, radius] = real[k];
+		if (carl::is_zero(radius)) {
+			res.emplace_back(center);
+			continue;
+		}
+		mpq_class step = 1;
+		while (step > radius) step /= 2;
+		while (step * 2 <= radius) step *= 2;
+		mpq_class lower = mpq_class(carl::floor((center - radius) / step)) * step;
+		mpq_class upper = mpq_class(carl::ceil((center + radius) / step)) * step;
+		if (!res.empty() && lower <= res.back().upper()) lower = center - radius;
+		if (k + 1 < real.size() && upper >= real[k + 1].first - real[k + 1].second) upper = center + radius;
+		if (sign_at(lower) == Sign::ZERO || sign_at(upper) == Sign::ZERO) {
+			CARL_LOG_DEBUG("carl.roots.aberth", "Bound of the interval around " << center << " is a root");
+			return std::nullopt;
+		}
+		res.emplace_back(lower, BoundType::STRICT, upper, BoundType::STRICT);
+	}
+	return res;
+}
+
+/**
+ * Isolates the real roots of a square-free polynomial with p(0) != 0 by certified numerical approximation.
+ *
+ * The roots are approximated by root_approximation() and certified by certify().
+ * The initial precision is 64 bits or more for large coefficients, as evaluations at lower precision are dominated by cancellation.
+ * If the approximation does not converge or certification fails, the precision is doubled, starting from the previous approximations.
+ * Approximations with an imaginary part below 2^-(precision/4) relative to their absolute value are considered real.
+ * @param coeffs Coefficients, starting with the constant coefficient.
+ * @param max_precision Precision in bits at which the method gives up.
+ * @return Isolating intervals (point intervals for rational roots) in ascending order, or nothing if the method failed.
+ */
+template<typename Float = DefaultFloat>
+std::optional<std::vector<Interval<mpq_class>>> isolate_real_roots(const std::vector<mpz_class>& coeffs, std::size_t max_precision = 4096) {
+	using traits = float_traits<Float>;
+	std::vector<Complex<mpq_class>> approximations;
+	std::size_t precision = 64;
+	for (const auto& c: coeffs) {
+		while (precision < carl::bitsize(c)) precision *= 2;
+	}
+	for (; precision <= max_precision; precision *= 2) {
+		auto [z, converged] = root_approximation<Float>(coeffs, precision, approximations);
+		approximations.clear();
+		for (const auto& zk: z) {
+			approximations.push_back(Complex<mpq_class>{traits::to_rational(zk.re), traits::to_rational(zk.im)});
+		}
+		if (!converged) continue;
+		// Project approximations with small imaginary part to the real axis.
+		mpq_class tolerance(1, carl::pow(mpz_class(2), precision / 4));
+		tolerance *= tolerance;
+		std::vector<Complex<mpq_class>> projected;
+		for (const auto& zk: approximations) {
+			if (zk.im * zk.im <= tolerance * (zk.norm() + 1)) {
+				projected.push_back(Complex<mpq_class>{zk.re, mpq_class(0)});
+			} else {
+				projected.push_back(zk);
+			}
+		}
+		auto res = certify(coeffs, projected, precision);
+		if (res) {
+			CARL_LOG_DEBUG("carl.roots.aberth", "Certified " << res->size() << " real roots with precision " << precision);
+			return res;
+		}
+	}
+	return std::nullopt;
+}
+
+}
+}
+}
@@ -0,0 +1,377 @@
+#pragma once
+
+#include "IntervalEvaluation.h"
+#include <carl-arith/core/Relation.h>
+#include <carl-arith/core/Sign.h>
+#include <carl-arith/interval/evaluate.h>
+#include <carl-arith/numbers/numbers.h>
+
+#include <carl-common/meta/platform.h>
+#ifdef USE_MPFR_FLOAT
+CLANG_WARNING_DISABLE("-Wsign-conversion")
+#include <mpfr.h>
+CLANG_WARNING_RESET
+#endif
+
+#include <boost/logic/tribool.hpp>
+#include <gmpxx.h>
+
+#include <map>
+#include <optional>
+
+namespace carl {
+
+/**
+ * The arithmetic used by an adaptive interval evaluation.
+ */
+enum class AdaptivePrecision { DOUBLE, MULTIPRECISION, EXACT, NONE };
+inline std::ostream& operator<<(std::ostream& os, AdaptivePrecision p) {
+	switch (p) {
+		case AdaptivePrecision::DOUBLE: return os << "double";
+		case AdaptivePrecision::MULTIPRECISION: return os << "multiprecision";
+		case AdaptivePrecision::EXACT: return os << "exact";
+		case AdaptivePrecision::NONE: return os << "none";
+	}
+	return os;
+}
+
+struct AdaptiveEvaluationSettings {
+	/// Precision (in bits) of the first multiprecision evaluation. Is doubled for every further evaluation.
+	std::size_t initial_precision = 128;
+	/// Largest precision (in bits) of a multiprecision evaluation.
+	std::size_t max_precision = 1024;
+	/// Whether to evaluate with exact rationals if no floating point evaluation is conclusive.
+	bool exact_fallback = true;
+};
+
+namespace detail_adaptive {
+
+/**
+ * Encloses an exact interval by a double interval by rounding outwards.
+ */
+template<typename Number>
+Interval<double> to_double_interval(const Interval<Number>& i) {
+	if (i.is_empty()) return Interval<double>::empty_interval();
+	return Interval<double>(i.lower(), i.lower_bound_type(), i.upper(), i.upper_bound_type());
+}
+
+#ifdef USE_MPFR_FLOAT
+/**
+ * A closed interval with mpfr bounds of a fixed precision, where all operations round outwards.
+ * Infinite bounds are represented by mpfr infinities.
+ */
+class MpfrInterval {
+	mpfr_t mLower;
+	mpfr_t mUpper;
+
+	/// Product of two bounds, where zero times infinity is zero.
+	static void mul_bound(mpfr_t res, const mpfr_t a, const mpfr_t b, mpfr_rnd_t rnd) {
+		if (mpfr_zero_p(a) || mpfr_zero_p(b)) mpfr_set_zero(res, 1);
+		else mpfr_mul(res, a, b, rnd);
+	}
+public:
+	explicit MpfrInterval(long prec) {
+		mpfr_init2(mLower, prec);
+		mpfr_init2(mUpper, prec);
+		mpfr_set_zero(mLower, 1);
+		mpfr_set_zero(mUpper, 1);
+	}
+	template<typename Number>
+	MpfrInterval(const Interval<Number>& i, long prec): MpfrInterval(prec) {
+		if (i.lower_bound_type() == BoundType::INFTY) {
+			mpfr_set_inf(mLower, -1);
+		} else {
+			mpq_class l = carl::convert<Number, mpq_class>(i.lower());
+			mpfr_set_q(mLower, l.get_mpq_t(), MPFR_RNDD);
+		}
+		if (i.upper_bound_type() == BoundType::INFTY) {
+			mpfr_set_inf(mUpper, 1);
+		} else {
+			mpq_class u = carl::convert<Number, mpq_class>(i.upper());
+			mpfr_set_q(mUpper, u.get_mpq_t(), MPFR_RNDU);
+		}
+	}
+	MpfrInterval(const MpfrInterval& i): MpfrInterval(mpfr_get_prec(i.mLower)) {
+		mpfr_set(mLower, i.mLower, MPFR_RNDD);
+		mpfr_set(mUpper, i.mUpper, MPFR_RNDU);
+	}
+	MpfrInterval& operator=(const MpfrInterval& i) {
+		mpfr_set(mLower, i.mLower, MPFR_RNDD);
+		mpfr_set(mUpper, i.mUpper, MPFR_RNDU);
+		return *this;
+	}
+	~MpfrInterval() {
+		mpfr_clear(mLower);
+		mpfr_clear(mUpper);
+	}
+
+	MpfrInterval& operator+=(const MpfrInterval& i) {
+		mpfr_add(mLower, mLower, i.mLower, MPFR_RNDD);
+		mpfr_add(mUpper, mUpper, i.mUpper, MPFR_RNDU);
+		return *this;
+	}
+	MpfrInterval& operator*=(const MpfrInterval& i) {
+		MpfrInterval tmp(mpfr_get_prec(mLower));
+		mpfr_t cand;
+		mpfr_init2(cand, mpfr_get_prec(mLower));
+		mpfr_set_inf(tmp.mLower, 1);
+		mpfr_set_inf(tmp.mUpper, -1);
+		for (const auto* a: {&mLower, &mUpper}) {
+			for (const auto* b: {&i.mLower, &i.mUpper}) {
+				mul_bound(cand, *a, *b, MPFR_RNDD);
+				mpfr_min(tmp.mLower, tmp.mLower, cand, MPFR_RNDD);
+				mul_bound(cand, *a, *b, MPFR_RNDU);
+				mpfr_max(tmp.mUpper, tmp.mUpper, cand, MPFR_RNDU);
+			}
+		}
+		mpfr_clear(cand);
+		return *this = tmp;
+	}
+	/// Raises to the given power, such that even powers are nonnegative.
+	MpfrInterval pow(uint exp) const {
+		MpfrInterval res(*this);
+		if (exp % 2 == 1 || mpfr_sgn(mLower) >= 0) {
+			mpfr_pow_ui(res.mLower, mLower, exp, MPFR_RNDD);
+			mpfr_pow_ui(res.mUpper, mUpper, exp, MPFR_RNDU);
+		} else if (mpfr_sgn(mUpper) <= 0) {
+			mpfr_pow_ui(res.mLower, mUpper, exp, MPFR_RNDD);
+			mpfr_pow_ui(res.mUpper, mLower, exp, MPFR_RNDU);
+		} else {
+			mpfr_t tmp;
+			mpfr_init2(tmp, mpfr_get_prec(mLower));
+			mpfr_pow_ui(res.mUpper, mLower, exp, MPFR_RNDU);
+			mpfr_pow_ui(tmp, mUpper, exp, MPFR_RNDU);
+			mpfr_max(res.mUpper, res.mUpper, tmp, MPFR_RNDU);
+			mpfr_set_zero(res.mLower, 1);
+			mpfr_clear(tmp);
+		}
+		return res;
+	}
+
+	/**
+	 * Returns a double interval whose bounds have the same signs as the bounds of this interval.
+	 * This suffices to decide signs and relations.
+	 */
+	Interval<double> sign_interval() const {
+		return Interval<double>(
+			static_cast<double>(mpfr_sgn(mLower)), mpfr_inf_p(mLower) ? BoundType::INFTY : BoundType::WEAK,
+			static_cast<double>(mpfr_sgn(mUpper)), mpfr_inf_p(mUpper) ? BoundType::INFTY : BoundType::WEAK
+		);
+	}
+};
+
+using MultiprecisionInterval = MpfrInterval;
+#else
+/**
+ * A closed interval whose bounds are dyadic rationals with a fixed number of significant bits, where all operations round outwards.
+ * Used for the multiprecision evaluation if carl is built without mpfr.
+ */
+class DyadicInterval {
+	/// A bound, either a finite value or an infinity of the given sign.
+	struct Bound {
+		mpq_class value;
+		int infinity = 0;
+
+		int sign() const {
+			return infinity != 0 ? infinity : sgn(value);
+		}
+	};
+	Bound mLower;
+	Bound mUpper;
+	long mPrecision;
+
+	/// Rounds to mPrecision significant bits.
+	mpq_class round(const mpq_class& q, bool up) const {
+		if (sgn(q) == 0) return q;
+		long magnitude = static_cast<long>(mpz_sizeinbase(q.get_num_mpz_t(), 2)) - static_cast<long>(mpz_sizeinbase(q.get_den_mpz_t(), 2));
+		long shift = mPrecision - magnitude;
+		mpz_class num = q.get_num();
+		mpz_class den = q.get_den();
+		if (shift >= 0) mpz_mul_2exp(num.get_mpz_t(), num.get_mpz_t(), static_cast<mp_bitcnt_t>(shift));
+		else mpz_mul_2exp(den.get_mpz_t(), den.get_mpz_t(), static_cast<mp_bitcnt_t>(-shift));
+		mpz_class m;
+		if (up) mpz_cdiv_q(m.get_mpz_t(), num.get_mpz_t(), den.get_mpz_t());
+		else mpz_fdiv_q(m.get_mpz_t(), num.get_mpz_t(), den.get_mpz_t());
+		mpq_class res(m);
+		if (shift >= 0) mpq_div_2exp(res.get_mpq_t(), res.get_mpq_t(), static_cast<mp_bitcnt_t>(shift));
+		else mpq_mul_2exp(res.get_mpq_t(), res.get_mpq_t(), static_cast<mp_bitcnt_t>(-shift));
+		return res;
+	}
+	Bound add_bound(const Bound& a, const Bound& b, bool up) const {
+		if (a.infinity != 0) return a;
+		if (b.infinity != 0) return b;
+		return Bound{ round(a.value + b.value, up), 0 };
+	}
+	/// Product of two bounds, where zero times infinity is zero.
+	Bound mul_bound(const Bound& a, const Bound& b, bool up) const {
+		if (a.sign() == 0 || b.sign() == 0) return Bound{ mpq_class(0), 0 };
+		if (a.infinity != 0 || b.infinity != 0) return Bound{ mpq_class(0), a.sign() * b.sign() };
+		return Bound{ round(a.value * b.value, up), 0 };
+	}
+	Bound pow_bound(const Bound& a, uint exp, bool up) const {
+		if (a.infinity != 0) return Bound{ mpq_class(0), exp % 2 == 0 ? 1 : a.infinity };
+		mpq_class res;
+		mpz_pow_ui(res.get_num_mpz_t(), a.value.get_num_mpz_t(), exp);
+		mpz_pow_ui(res.get_den_mpz_t(), a.value.get_den_mpz_t(), exp);
+		return Bound{ round(res, up), 0 };
+	}
+	static bool less(const Bound& a, const Bound& b) {
+		if (a.infinity != b.infinity) return a.infinity < b.infinity;
+		return a.infinity == 0 && a.value < b.value;
+	}
+public:
+	explicit DyadicInterval(long prec): mPrecision(prec) {}
+	template<typename Number>
+	DyadicInterval(const Interval<Number>& i, long prec): DyadicInterval(prec) {
+		if (i.lower_bound_type() == BoundType::INFTY) {
+			mLower.infinity = -1;
+		} else {
+			mLower.value = round(carl::convert<Number, mpq_class>(i.lower()), false);
+		}
+		if (i.upper_bound_type() == BoundType::INFTY) {
+			mUpper.infinity = 1;
+		} else {
+			mUpper.value = round(carl::convert<Number, mpq_class>(i.upper()), true);
+		}
+	}
+
+	DyadicInterval& operator+=(const DyadicInterval& i) {
+		mLower = add_bound(mLower, i.mLower, false);
+		mUpper = add_bound(mUpper, i.mUpper, true);
+		return *this;
+	}
+	DyadicInterval& operator*=(const DyadicInterval& i) {
+		Bound lower{ mpq_class(0), 1 };
+		Bound upper{ mpq_class(0), -1 };
+		for (const auto* a: {&mLower, &mUpper}) {
+			for (const auto* b: {&i.mLower, &i.mUpper}) {
+				Bound cand = mul_bound(*a, *b, false);
+				if (less(cand, lower)) lower = cand;
+				cand = mul_bound(*a, *b, true);
+				if (less(upper, cand)) upper = cand;
+			}
+		}
+		mLower = lower;
+		mUpper = upper;
+		return *this;
+	}
+	/// Raises to the given power, such that even powers are nonnegative.
+	DyadicInterval pow(uint exp) const {
+		DyadicInterval res(mPrecision);
+		if (exp % 2 == 1 || mLower.sign() >= 0) {
+			res.mLower = pow_bound(mLower, exp, false);
+			res.mUpper = pow_bound(mUpper, exp, true);
+		} else if (mUpper.sign() <= 0) {
+			res.mLower = pow_bound(mUpper, exp, false);
+			res.mUpper = pow_bound(mLower, exp, true);
+		} else {
+			res.mUpper = pow_bound(mLower, exp, true);
+			Bound tmp = pow_bound(mUpper, exp, true);
+			if (less(res.mUpper, tmp)) res.mUpper = tmp;
+		}
+		return res;
+	}
+
+	/**
+	 * Returns a double interval whose bounds have the same signs as the bounds of this interval.
+	 * This suffices to decide signs and relations.
+	 */
+	Interval<double> sign_interval() const {
+		return Interval<double>(
+			static_cast<double>(mLower.sign()), mLower.infinity != 0 ? BoundType::INFTY : BoundType::WEAK,
+			static_cast<double>(mUpper.sign()), mUpper.infinity != 0 ? BoundType::INFTY : BoundType::WEAK
+		);
+	}
+};
+
+using MultiprecisionInterval = DyadicInterval;
+#endif
+
+template<typename Coeff, typename Policy, typename Ordering>
+MultiprecisionInterval evaluate_multiprecision(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, MultiprecisionInterval>& map, long prec) {
+	MultiprecisionInterval res(prec);
+	for (const auto& t: p) {
+		MultiprecisionInterval term(Interval<Coeff>(t.coeff()), prec);
+		if (t.monomial()) {
+			for (const auto& [var, exp]: *t.monomial()) {
+				term *= map.at(var).pow(exp);
+			}
+		}
+		res += term;
+	}
+	return res;
+}
+
+/**
+ * Evaluates p over the given intervals with increasing precision until decide() returns a value that is not indeterminate.
+ * decide() is only passed enclosures of the value of p and only looks at the signs of its bounds.
+ */
+template<typename Coeff, typename Policy, typename Ordering, typename Number, typename Decider>
+boost::tribool decide_adaptive(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Number>>& map, const AdaptiveEvaluationSettings& settings, AdaptivePrecision* used, Decider&& decide) {
+	if (used != nullptr) *used = AdaptivePrecision::NONE;
+	{
+		std::map<Variable, Interval<double>> dmap;
+		for (const auto& [var, i]: map) {
+			dmap.emplace_hint(dmap.end(), var, to_double_interval(i));
+		}
+		boost::tribool res = decide(carl::evaluate(p, dmap));
+		CARL_LOG_TRACE("carl.core.intervalevaluation", "Evaluation with double: " << res);
+		if (!boost::indeterminate(res)) {
+			if (used != nullptr) *used = AdaptivePrecision::DOUBLE;
+			return res;
+		}
+	}
+	for (std::size_t prec = settings.initial_precision; prec <= settings.max_precision; prec *= 2) {
+		std::map<Variable, MultiprecisionInterval> mmap;
+		for (const auto& [var, i]: map) {
+			mmap.emplace_hint(mmap.end(), var, MultiprecisionInterval(i, static_cast<long>(prec)));
+		}
+		boost::tribool res = decide(evaluate_multiprecision(p, mmap, static_cast<long>(prec)).sign_interval());
+		CARL_LOG_TRACE("carl.core.intervalevaluation", "Multiprecision evaluation (" << prec << " bits): " << res);
+		if (!boost::indeterminate(res)) {
+			if (used != nullptr) *used = AdaptivePrecision::MULTIPRECISION;
+			return res;
+		}
+	}
+	if (!settings.exact_fallback) return boost::indeterminate;
+	boost::tribool res = decide(carl::evaluate(p, map));
+	CARL_LOG_TRACE("carl.core.intervalevaluation", "Exact evaluation: " << res);
+	if (!boost::indeterminate(res) && used != nullptr) *used = AdaptivePrecision::EXACT;
+	return res;
+}
+
+}
+
+/**
+ * Decides whether p is related to zero by the given relation on all points of the given intervals.
+ * Evaluates with doubles first, then with multiprecision bounds of doubling precision and finally with exact rationals.
+ * The multiprecision stage uses mpfr if carl is built with USE_MPFR_FLOAT (which is off by default) and dyadic rationals rounded with gmp otherwise.
+ * Every stage is a sound enclosure, thus a result of true or false is always correct.
+ * @param used If given, is set to the arithmetic that decided the relation.
+ * @return true or false if the relation holds on all or no points, indeterminate if interval evaluation is inconclusive.
+ */
+template<typename Coeff, typename Policy, typename Ordering, typename Number>
+boost::tribool evaluate_adaptive(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Number>>& map, Relation relation, const AdaptiveEvaluationSettings& settings = AdaptiveEvaluationSettings(), AdaptivePrecision* used = nullptr) {
+	return detail_adaptive::decide_adaptive(p, map, settings, used, [relation](const auto& i) {
+		return carl::evaluate(i, relation);
+	});
+}
+
+/**
+ * Determines the sign of p on the given intervals, if it is the same on all points.
+ * @see evaluate_adaptive
+ */
+template<typename Coeff, typename Policy, typename Ordering, typename Number>
+std::optional<Sign> sgn_adaptive(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Number>>& map, const AdaptiveEvaluationSettings& settings = AdaptiveEvaluationSettings(), AdaptivePrecision* used = nullptr) {
+	std::optional<Sign> res;
+	detail_adaptive::decide_adaptive(p, map, settings, used, [&res](const auto& i) -> boost::tribool {
+		if (i.is_positive()) res = Sign::POSITIVE;
+		else if (i.is_negative()) res = Sign::NEGATIVE;
+		else if (i.is_zero()) res = Sign::ZERO;
+		else return boost::indeterminate;
+		return true;
+	});
+	return res;
+}
+
+}
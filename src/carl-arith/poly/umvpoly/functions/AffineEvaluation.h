@@ -0,0 +1,137 @@
+#pragma once
+
+#include "DensePolynomial.h"
+#include "../MultivariatePolynomial.h"
+#include <carl-arith/interval/IntervalBox.h>
+#include <carl-arith/interval/set_theory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace carl {
+
+namespace detail_affine {
+
+/**
+ * An affine form c + sum a_i * e_i + err * e, where all e_i and e range over [-1, 1].
+ * The center and the partial deviations are intervals such that floating point errors are enclosed soundly.
+ * The noise symbol e_i belongs to the i'th variable, e collects all nonlinear deviations.
+ */
+struct AffineForm {
+	Interval<double> center;
+	std::vector<Interval<double>> deviations;
+	/// Upper bound on the nonlinear deviation.
+	double error = 0;
+
+	explicit AffineForm(std::size_t size, const Interval<double>& c = Interval<double>(0)):
+		center(c), deviations(size, Interval<double>(0))
+	{}
+
+	/// Upper bound on the total deviation from the center.
+	double radius() const {
+		Interval<double> res(error);
+		for (const auto& d: deviations) res += Interval<double>(d.magnitude());
+		return res.upper();
+	}
+
+	AffineForm& operator+=(const AffineForm& rhs) {
+		center += rhs.center;
+		for (std::size_t i = 0; i < deviations.size(); ++i) {
+			deviations[i] += rhs.deviations[i];
+		}
+		error = (Interval<double>(error) + Interval<double>(rhs.error)).upper();
+		return *this;
+	}
+
+	/**
+	 * Multiplies two affine forms.
+	 * The product of the deviations is bounded by the product of the radii and added to the nonlinear deviation.
+	 */
+	AffineForm operator*(const AffineForm& rhs) const {
+		AffineForm res(deviations.size(), center * rhs.center);
+		for (std::size_t i = 0; i < deviations.size(); ++i) {
+			res.deviations[i] = center * rhs.deviations[i] + rhs.center * deviations[i];
+		}
+		Interval<double> err = Interval<double>(radius()) * Interval<double>(rhs.radius());
+		err += Interval<double>(center.magnitude()) * Interval<double>(rhs.error);
+		err += Interval<double>(rhs.center.magnitude()) * Interval<double>(error);
+		res.error = err.upper();
+		return res;
+	}
+
+	AffineForm& operator*=(const Interval<double>& factor) {
+		center *= factor;
+		for (auto& d: deviations) d *= factor;
+		error = (Interval<double>(error) * Interval<double>(factor.magnitude())).upper();
+		return *this;
+	}
+
+	/// The range of this affine form.
+	Interval<double> range() const {
+		Interval<double> unit(-1, 1);
+		Interval<double> res = center + Interval<double>(-error, error);
+		for (const auto& d: deviations) res += d * unit;
+		return res;
+	}
+};
+
+}
+
+/**
+ * Evaluates a polynomial over interval boxes using affine arithmetic.
+ *
+ * Affine arithmetic keeps track of the linear dependencies between subterms and thus suffers less from the dependency problem than interval evaluation.
+ * The polynomial is compiled once, with coefficients enclosed by double intervals, and can then be evaluated over many boxes.
+ */
+class AffineEvaluator {
+	DensePolynomial mPolynomial;
+public:
+	template<typename Coeff, typename Policy, typename Ordering>
+	explicit AffineEvaluator(const MultivariatePolynomial<Coeff, Policy, Ordering>& p):
+		mPolynomial(p)
+	{}
+
+	/// The variables of the compiled polynomial.
+	const std::vector<Variable>& variables() const {
+		return mPolynomial.variables();
+	}
+
+	/**
+	 * Evaluates with affine arithmetic.
+	 * The result is intersected with the result of interval evaluation, thus it is never worse than carl::evaluate().
+	 * If any variable is unbounded, only interval arithmetic is used.
+	 */
+	Interval<double> evaluate(const IntervalBox& box) const {
+		if (box.is_empty()) return Interval<double>::empty_interval();
+		std::vector<std::size_t> pos = mPolynomial.positions(box);
+		Interval<double> natural = mPolynomial.evaluate(box, pos);
+		bool bounded = std::all_of(pos.begin(), pos.end(), [&box](std::size_t p){ return std::isfinite(box.width(p)); });
+		if (!bounded) return natural;
+
+		std::size_t size = pos.size();
+		std::vector<detail_affine::AffineForm> vars;
+		vars.reserve(size);
+		for (std::size_t i = 0; i < size; ++i) {
+			double mid = box.midpoint(pos[i]);
+			auto& form = vars.emplace_back(size, Interval<double>(mid));
+			Interval<double> rad = Interval<double>(box.upper()[pos[i]]) - Interval<double>(mid);
+			rad = rad.convex_hull(Interval<double>(mid) - Interval<double>(box.lower()[pos[i]]));
+			form.deviations[i] = Interval<double>(rad.upper());
+		}
+		detail_affine::AffineForm res(size);
+		for (const auto& t: mPolynomial.terms()) {
+			detail_affine::AffineForm cur(size, Interval<double>(1));
+			for (const auto& [var, exp]: t.powers) {
+				for (uint e = 0; e < exp; ++e) {
+					cur = cur * vars[var];
+				}
+			}
+			cur *= t.coeff;
+			res += cur;
+		}
+		return set_intersection(res.range(), natural);
+	}
+};
+
+}
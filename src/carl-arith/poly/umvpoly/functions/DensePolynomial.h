@@ -0,0 +1,129 @@
+#pragma once
+
+#include <carl-arith/core/Variable.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBox.h>
+#include <carl-arith/interval/power.h>
+
+#include <map>
+#include <vector>
+
+namespace carl {
+
+/**
+ * The variables of a compiled polynomial, numbered densely in the order they were added.
+ * Maps these numbers to positions in an IntervalBox.
+ */
+class DenseVariables {
+	std::vector<Variable> mVariables;
+	std::map<Variable, std::size_t> mIndices;
+public:
+	/**
+	 * Adds the given variable, if it is not yet present.
+	 * @return Number of the variable.
+	 */
+	std::size_t add(Variable v) {
+		auto it = mIndices.try_emplace(v, mVariables.size()).first;
+		if (it->second == mVariables.size()) mVariables.emplace_back(v);
+		return it->second;
+	}
+
+	std::size_t size() const {
+		return mVariables.size();
+	}
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+
+	/// Returns the position in the given box for every variable. The box must contain all variables.
+	std::vector<std::size_t> positions(const IntervalBox& box) const {
+		std::vector<std::size_t> res;
+		res.reserve(mVariables.size());
+		for (auto v: mVariables) {
+			assert(box.has(v));
+			res.emplace_back(box.position(v));
+		}
+		return res;
+	}
+	/// Appends the intervals of all variables from the given box to the output. The box must contain all variables.
+	void intervals(const IntervalBox& box, std::vector<Interval<double>>& out) const {
+		for (auto v: mVariables) {
+			assert(box.has(v));
+			out.emplace_back(box.interval(box.position(v)));
+		}
+	}
+};
+
+/**
+ * A polynomial compiled for repeated interval evaluation over IntervalBoxes.
+ *
+ * Coefficients are enclosed by double intervals and variables are replaced by their numbers in variables().
+ * Evaluation yields the same enclosure as carl::evaluate() on an IntervalBox, but without converting coefficients.
+ * If the positions of the variables in the box are known, they can be passed to avoid looking up the variables.
+ */
+class DensePolynomial {
+public:
+	struct Term {
+		Interval<double> coeff;
+		/// Pairs of variable number and exponent.
+		std::vector<std::pair<std::size_t, uint>> powers;
+	};
+private:
+	DenseVariables mVariables;
+	std::vector<Term> mTerms;
+public:
+	DensePolynomial() = default;
+
+	template<typename Polynomial>
+	explicit DensePolynomial(const Polynomial& p) {
+		for (const auto& t: p) {
+			Term term{ Interval<double>(t.coeff()), {} };
+			if (t.monomial()) {
+				for (const auto& [var, exp]: *t.monomial()) {
+					term.powers.emplace_back(mVariables.add(var), exp);
+				}
+			}
+			mTerms.emplace_back(std::move(term));
+		}
+	}
+
+	const DenseVariables& dense_variables() const {
+		return mVariables;
+	}
+	/// The variables, in the order of their numbers.
+	const std::vector<Variable>& variables() const {
+		return mVariables.variables();
+	}
+	const std::vector<Term>& terms() const {
+		return mTerms;
+	}
+	/// @see DenseVariables::positions
+	std::vector<std::size_t> positions(const IntervalBox& box) const {
+		return mVariables.positions(box);
+	}
+
+	/**
+	 * Evaluates over the given box.
+	 * @param positions The position in the box for every variable, as returned by positions().
+	 */
+	Interval<double> evaluate(const IntervalBox& box, const std::vector<std::size_t>& positions) const {
+		assert(positions.size() == mVariables.size());
+		Interval<double> res(0);
+		for (const auto& t: mTerms) {
+			Interval<double> cur = t.coeff;
+			for (const auto& [var, exp]: t.powers) {
+				cur *= carl::pow(box.interval(positions[var]), exp);
+				if (cur.is_zero()) break;
+			}
+			res += cur;
+			if (res.is_infinite()) break;
+		}
+		return res;
+	}
+	/// Evaluates over the given box, which must contain all variables().
+	Interval<double> evaluate(const IntervalBox& box) const {
+		return evaluate(box, positions(box));
+	}
+};
+
+}
@@ -0,0 +1,601 @@
+#pragma once
+
+#include <carl-arith/numbers/numbers.h>
+#include <carl-arith/numbers/PrimeFactory.h>
+#include <carl-logging/carl-logging.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @file
+ * Factorization of primitive squarefree univariate integer polynomials as described in @cite GG13, chapters 14 and 15:
+ * the polynomial is factored modulo a few small primes, the modular factorization with the fewest factors is lifted by
+ * quadratic Hensel lifting, and the irreducible factors over the integers are recovered by recombining the lifted factors.
+ * Polynomials are dense coefficient vectors starting with the constant coefficient.
+ */
+
+namespace carl::zassenhaus {
+
+/// Dense polynomial over a prime field without leading zeros.
+using ModPoly = std::vector<std::uint64_t>;
+/// Dense polynomial with integer coefficients.
+template<typename Integer>
+using IntPoly = std::vector<Integer>;
+
+/**
+ * Arithmetic in Z_p and Z_p[x] for an odd prime p below 2^32, such that all products fit into a machine word.
+ */
+class PrimeField {
+	std::uint64_t m_p;
+public:
+	explicit PrimeField(std::uint64_t p): m_p(p) {
+		assert(p > 2 && p < (std::uint64_t(1) << 32));
+	}
+	std::uint64_t p() const {
+		return m_p;
+	}
+
+	std::uint64_t add(std::uint64_t a, std::uint64_t b) const {
+		return (a + b) % m_p;
+	}
+	std::uint64_t sub(std::uint64_t a, std::uint64_t b) const {
+		return (a + m_p - b) % m_p;
+	}
+	std::uint64_t mul(std::uint64_t a, std::uint64_t b) const {
+		return (a * b) % m_p;
+	}
+	std::uint64_t pow(std::uint64_t a, std::uint64_t e) const {
+		std::uint64_t res = 1;
+		while (e > 0) {
+			if (e & 1) res = mul(res, a);
+			a = mul(a, a);
+			e >>= 1;
+		}
+		return res;
+	}
+	std::uint64_t inv(std::uint64_t a) const {
+		assert(a != 0);
+		return pow(a, m_p - 2);
+	}
+
+	static void trim(ModPoly& a) {
+		while (!a.empty() && a.back() == 0) a.pop_back();
+	}
+	ModPoly sub(const ModPoly& a, const ModPoly& b) const {
+		ModPoly res(std::max(a.size(), b.size()), 0);
+		for (std::size_t i = 0; i < a.size(); ++i) res[i] = a[i];
+		for (std::size_t i = 0; i < b.size(); ++i) res[i] = sub(res[i], b[i]);
+		trim(res);
+		return res;
+	}
+	ModPoly mul(const ModPoly& a, const ModPoly& b) const {
+		if (a.empty() || b.empty()) return {};
+		ModPoly res(a.size() + b.size() - 1, 0);
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			if (a[i] == 0) continue;
+			for (std::size_t j = 0; j < b.size(); ++j) {
+				res[i + j] = (res[i + j] + a[i] * b[j]) % m_p;
+			}
+		}
+		trim(res);
+		return res;
+	}
+	ModPoly scale(ModPoly a, std::uint64_t c) const {
+		for (auto& coeff: a) coeff = mul(coeff, c);
+		trim(a);
+		return a;
+	}
+	ModPoly monic(const ModPoly& a) const {
+		if (a.empty()) return a;
+		return scale(a, inv(a.back()));
+	}
+	/// Computes the remainder of a divided by the nonzero polynomial b and optionally stores the quotient.
+	ModPoly rem(ModPoly a, const ModPoly& b, ModPoly* quotient = nullptr) const {
+		assert(!b.empty());
+		std::uint64_t lcinv = inv(b.back());
+		if (quotient != nullptr) quotient->assign(a.size() >= b.size() ? a.size() - b.size() + 1 : 0, 0);
+		while (a.size() >= b.size()) {
+			std::size_t shift = a.size() - b.size();
+			std::uint64_t c = mul(a.back(), lcinv);
+			if (quotient != nullptr) (*quotient)[shift] = c;
+			for (std::size_t i = 0; i < b.size(); ++i) {
+				a[shift + i] = sub(a[shift + i], mul(c, b[i]));
+			}
+			assert(a.back() == 0);
+			trim(a);
+		}
+		return a;
+	}
+	ModPoly derivative(const ModPoly& a) const {
+		ModPoly res;
+		for (std::size_t i = 1; i < a.size(); ++i) res.push_back(mul(a[i], i % m_p));
+		trim(res);
+		return res;
+	}
+	/// Computes the monic gcd of a and b.
+	ModPoly gcd(ModPoly a, ModPoly b) const {
+		while (!b.empty()) {
+			a = rem(std::move(a), b);
+			std::swap(a, b);
+		}
+		return monic(a);
+	}
+	/**
+	 * Computes the monic gcd g of a and b and Bezout coefficients such that s*a + t*b = g.
+	 * If the gcd is one, deg(s) < deg(b) and deg(t) < deg(a).
+	 */
+	ModPoly extended_gcd(const ModPoly& a, const ModPoly& b, ModPoly& s, ModPoly& t) const {
+		ModPoly r0 = a, r1 = b;
+		ModPoly s0 = {1}, s1;
+		ModPoly t0, t1 = {1};
+		while (!r1.empty()) {
+			ModPoly q;
+			ModPoly r2 = rem(r0, r1, &q);
+			trim(q);
+			ModPoly s2 = sub(s0, mul(q, s1));
+			ModPoly t2 = sub(t0, mul(q, t1));
+			r0 = std::move(r1); r1 = std::move(r2);
+			s0 = std::move(s1); s1 = std::move(s2);
+			t0 = std::move(t1); t1 = std::move(t2);
+		}
+		std::uint64_t c = inv(r0.back());
+		s = scale(s0, c);
+		t = scale(t0, c);
+		return scale(r0, c);
+	}
+	/// Computes a^e modulo f.
+	ModPoly powmod(ModPoly a, std::uint64_t e, const ModPoly& f) const {
+		ModPoly res = {1};
+		a = rem(std::move(a), f);
+		while (e > 0) {
+			if (e & 1) res = rem(mul(res, a), f);
+			e >>= 1;
+			if (e > 0) a = rem(mul(a, a), f);
+		}
+		return res;
+	}
+
+	/**
+	 * Distinct-degree factorization of a monic squarefree polynomial f.
+	 * @return Pairs of a degree d and the product of all irreducible factors of f of degree d.
+	 */
+	std::vector<std::pair<std::size_t, ModPoly>> distinct_degree_factorization(ModPoly f) const {
+		std::vector<std::pair<std::size_t, ModPoly>> res;
+		const ModPoly x = {0, 1};
+		ModPoly h = x;
+		for (std::size_t d = 1; 2 * d < f.size(); ++d) {
+			h = powmod(h, m_p, f);
+			ModPoly g = gcd(f, sub(h, x));
+			if (g.size() > 1) {
+				ModPoly q;
+				rem(f, g, &q);
+				f = std::move(q);
+				h = rem(h, f);
+				res.emplace_back(d, std::move(g));
+			}
+		}
+		if (f.size() > 1) res.emplace_back(f.size() - 1, std::move(f));
+		return res;
+	}
+
+	/**
+	 * Splits a monic squarefree polynomial g whose irreducible factors all have degree d (Cantor-Zassenhaus).
+	 * A random polynomial a yields the split gcd(g, a^((p^d-1)/2) - 1) with probability about 1/2.
+	 */
+	void equal_degree_factorization(const ModPoly& g, std::size_t d, std::mt19937_64& rand, std::vector<ModPoly>& factors) const {
+		if (g.size() - 1 == d) {
+			factors.push_back(g);
+			return;
+		}
+		std::uniform_int_distribution<std::uint64_t> coeff(0, m_p - 1);
+		while (true) {
+			ModPoly a(g.size() - 1);
+			for (auto& c: a) c = coeff(rand);
+			trim(a);
+			if (a.size() < 2) continue;
+			// a^((p^d-1)/2) = (a^(1+p+...+p^(d-1)))^((p-1)/2)
+			ModPoly t = a, s = a;
+			for (std::size_t i = 1; i < d; ++i) {
+				t = powmod(t, m_p, g);
+				s = rem(mul(s, t), g);
+			}
+			ModPoly b = powmod(s, (m_p - 1) / 2, g);
+			ModPoly h = gcd(g, sub(b, ModPoly({1})));
+			if (h.size() > 1 && h.size() < g.size()) {
+				ModPoly q;
+				rem(g, h, &q);
+				equal_degree_factorization(h, d, rand, factors);
+				equal_degree_factorization(q, d, rand, factors);
+				return;
+			}
+		}
+	}
+
+	/// Computes the monic irreducible factors of a monic squarefree polynomial.
+	std::vector<ModPoly> factor(const ModPoly& f) const {
+		std::vector<ModPoly> factors;
+		std::mt19937_64 rand(m_p);
+		for (const auto& [d, g]: distinct_degree_factorization(f)) {
+			equal_degree_factorization(g, d, rand, factors);
+		}
+		return factors;
+	}
+};
+
+/// Reduces n into [0,m).
+template<typename Integer>
+Integer mod_positive(const Integer& n, const Integer& m) {
+	Integer r = carl::mod(n, m);
+	if (r < 0) r += m;
+	return r;
+}
+
+/// Reduces n into the symmetric range (-m/2,m/2].
+template<typename Integer>
+Integer mod_symmetric(const Integer& n, const Integer& m) {
+	Integer r = mod_positive(n, m);
+	if (2 * r > m) r -= m;
+	return r;
+}
+
+template<typename Integer>
+void trim(IntPoly<Integer>& a) {
+	while (!a.empty() && carl::is_zero(a.back())) a.pop_back();
+}
+
+/// Reduces all coefficients into [0,m).
+template<typename Integer>
+IntPoly<Integer> reduce(IntPoly<Integer> a, const Integer& m) {
+	for (auto& c: a) c = mod_positive(c, m);
+	trim(a);
+	return a;
+}
+
+template<typename Integer>
+ModPoly to_mod(const IntPoly<Integer>& a, const PrimeField& field) {
+	Integer p(field.p());
+	ModPoly res;
+	res.reserve(a.size());
+	for (const auto& c: a) res.push_back(carl::to_int<carl::uint>(mod_positive(c, p)));
+	PrimeField::trim(res);
+	return res;
+}
+
+template<typename Integer>
+IntPoly<Integer> from_mod(const ModPoly& a) {
+	return IntPoly<Integer>(a.begin(), a.end());
+}
+
+template<typename Integer>
+IntPoly<Integer> mul(const IntPoly<Integer>& a, const IntPoly<Integer>& b) {
+	if (a.empty() || b.empty()) return {};
+	IntPoly<Integer> res(a.size() + b.size() - 1, Integer(0));
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		if (carl::is_zero(a[i])) continue;
+		for (std::size_t j = 0; j < b.size(); ++j) {
+			res[i + j] += a[i] * b[j];
+		}
+	}
+	return res;
+}
+
+template<typename Integer>
+IntPoly<Integer> add(IntPoly<Integer> a, const IntPoly<Integer>& b) {
+	if (a.size() < b.size()) a.resize(b.size(), Integer(0));
+	for (std::size_t i = 0; i < b.size(); ++i) a[i] += b[i];
+	trim(a);
+	return a;
+}
+
+template<typename Integer>
+IntPoly<Integer> sub(IntPoly<Integer> a, const IntPoly<Integer>& b) {
+	if (a.size() < b.size()) a.resize(b.size(), Integer(0));
+	for (std::size_t i = 0; i < b.size(); ++i) a[i] -= b[i];
+	trim(a);
+	return a;
+}
+
+/// Divides a by the monic polynomial b modulo m and returns quotient and remainder, reduced into [0,m).
+template<typename Integer>
+std::pair<IntPoly<Integer>, IntPoly<Integer>> divide_monic(IntPoly<Integer> a, const IntPoly<Integer>& b, const Integer& m) {
+	assert(!b.empty() && carl::is_one(b.back()));
+	a = reduce(std::move(a), m);
+	IntPoly<Integer> q(a.size() >= b.size() ? a.size() - b.size() + 1 : 0, Integer(0));
+	while (a.size() >= b.size()) {
+		std::size_t shift = a.size() - b.size();
+		Integer c = a.back();
+		q[shift] = c;
+		for (std::size_t i = 0; i < b.size(); ++i) {
+			a[shift + i] = mod_positive(Integer(a[shift + i] - c * b[i]), m);
+		}
+		trim(a);
+	}
+	return std::make_pair(reduce(std::move(q), m), std::move(a));
+}
+
+/**
+ * Lifts f = g*h mod m with s*g + t*h = 1 mod m to the same equations modulo m^2, see @cite GG13, algorithm 15.10.
+ * The polynomial h is monic and deg(s) < deg(h), deg(t) < deg(g) hold before and after the step.
+ */
+template<typename Integer>
+void hensel_step(const IntPoly<Integer>& f, IntPoly<Integer>& g, IntPoly<Integer>& h, IntPoly<Integer>& s, IntPoly<Integer>& t, Integer& m) {
+	Integer m2 = m * m;
+	auto e = reduce(sub(f, mul(g, h)), m2);
+	auto [q, r] = divide_monic(mul(s, e), h, m2);
+	g = reduce(add(add(g, mul(t, e)), mul(q, g)), m2);
+	h = reduce(add(h, r), m2);
+	auto b = reduce(sub(add(mul(s, g), mul(t, h)), IntPoly<Integer>({Integer(1)})), m2);
+	auto [c, d] = divide_monic(mul(s, b), h, m2);
+	s = reduce(sub(s, d), m2);
+	t = reduce(sub(sub(t, mul(t, b)), mul(c, g)), m2);
+	m = m2;
+}
+
+/**
+ * Lifts the factorization f = lc(f) * u_1 * ... * u_r mod p into monic pairwise coprime factors to a factorization modulo p^(2^steps).
+ * The factors are split off one after another, each by a sequence of quadratic Hensel steps.
+ * @return The lifted monic factors, reduced into [0,p^(2^steps)).
+ */
+template<typename Integer>
+std::vector<IntPoly<Integer>> hensel_lift(const IntPoly<Integer>& f, const PrimeField& field, const std::vector<ModPoly>& factors, std::size_t steps, const Integer& modulus) {
+	std::vector<IntPoly<Integer>> res;
+	IntPoly<Integer> remaining = reduce(f, modulus);
+	for (std::size_t i = 0; i + 1 < factors.size(); ++i) {
+		ModPoly g0 = {to_mod(remaining, field).back()};
+		for (std::size_t j = i + 1; j < factors.size(); ++j) g0 = field.mul(g0, factors[j]);
+		ModPoly s0, t0;
+		[[maybe_unused]] ModPoly one = field.extended_gcd(g0, factors[i], s0, t0);
+		assert(one == ModPoly({1}));
+		IntPoly<Integer> g = from_mod<Integer>(g0);
+		IntPoly<Integer> h = from_mod<Integer>(factors[i]);
+		IntPoly<Integer> s = from_mod<Integer>(s0);
+		IntPoly<Integer> t = from_mod<Integer>(t0);
+		Integer m(field.p());
+		for (std::size_t k = 0; k < steps; ++k) {
+			hensel_step(reduce(remaining, Integer(m * m)), g, h, s, t, m);
+		}
+		assert(m == modulus);
+		res.emplace_back(std::move(h));
+		remaining = std::move(g);
+	}
+	// Make the last factor monic: invert its leading coefficient modulo p^(2^steps) by Newton iteration.
+	Integer m(field.p());
+	Integer inv(field.inv(to_mod(remaining, field).back()));
+	for (std::size_t k = 0; k < steps; ++k) {
+		m *= m;
+		inv = mod_positive(Integer(inv * (2 - remaining.back() * inv)), m);
+	}
+	for (auto& c: remaining) c = mod_positive(Integer(c * inv), modulus);
+	res.emplace_back(std::move(remaining));
+	return res;
+}
+
+template<typename Integer>
+Integer content(const IntPoly<Integer>& a) {
+	Integer res(0);
+	for (const auto& c: a) res = carl::gcd(res, c);
+	return carl::abs(res);
+}
+
+/**
+ * Divides a by b over the integers.
+ * @return The quotient, or nothing if b does not divide a.
+ */
+template<typename Integer>
+std::optional<IntPoly<Integer>> exact_quotient(IntPoly<Integer> a, const IntPoly<Integer>& b) {
+	if (a.size() < b.size()) return std::nullopt;
+	IntPoly<Integer> q(a.size() - b.size() + 1, Integer(0));
+	for (std::size_t shift = q.size(); shift-- > 0;) {
+		const Integer& lead = a[shift + b.size() - 1];
+		if (carl::is_zero(lead)) continue;
+		if (!carl::is_zero(carl::mod(lead, b.back()))) return std::nullopt;
+		Integer c = carl::quotient(lead, b.back());
+		for (std::size_t i = 0; i < b.size(); ++i) a[shift + i] -= c * b[i];
+		q[shift] = std::move(c);
+	}
+	for (const auto& c: a) {
+		if (!carl::is_zero(c)) return std::nullopt;
+	}
+	return q;
+}
+
+/// Enumerates the subsets of {0,...,n-1} with k elements in lexicographic order.
+class SubsetEnumerator {
+	std::size_t m_n;
+	std::vector<std::size_t> m_subset;
+	bool m_valid;
+public:
+	SubsetEnumerator(std::size_t n, std::size_t k): m_n(n), m_subset(k), m_valid(k <= n) {
+		for (std::size_t i = 0; i < k; ++i) m_subset[i] = i;
+	}
+	bool valid() const {
+		return m_valid;
+	}
+	const std::vector<std::size_t>& operator*() const {
+		return m_subset;
+	}
+	SubsetEnumerator& operator++() {
+		std::size_t k = m_subset.size();
+		std::size_t i = k;
+		while (i > 0 && m_subset[i - 1] == m_n - k + i - 1) --i;
+		if (i == 0) {
+			m_valid = false;
+		} else {
+			++m_subset[i - 1];
+			for (std::size_t j = i; j < k; ++j) m_subset[j] = m_subset[j - 1] + 1;
+		}
+		return *this;
+	}
+};
+
+/**
+ * Recombines lifted modular factors to factors over the integers.
+ * For a subset S of the modular factors, the candidate is the primitive part of lc(f) * prod_{i in S} u_i, with
+ * coefficients in the symmetric range modulo m. Since m exceeds twice the Mignotte bound, every factor over the integers
+ * is such a candidate. Subsets are tried by increasing size; if parallel is set, a batch of subsets is checked concurrently.
+ */
+template<typename Integer>
+class Recombination {
+	IntPoly<Integer> m_f;
+	std::vector<IntPoly<Integer>> m_lifted;
+	Integer m_modulus;
+	bool m_parallel;
+
+	/// Returns the candidate factor for the given subset, if it divides f.
+	std::optional<IntPoly<Integer>> try_subset(const std::vector<std::size_t>& subset) const {
+		const Integer& lc = m_f.back();
+		// Check the constant coefficient first, as it is cheap and rules out most subsets.
+		Integer constant = lc;
+		for (auto i: subset) constant = mod_positive(Integer(constant * m_lifted[i].front()), m_modulus);
+		constant = mod_symmetric(constant, m_modulus);
+		if (carl::is_zero(constant) || !carl::is_zero(carl::mod(Integer(lc * m_f.front()), constant))) return std::nullopt;
+
+		IntPoly<Integer> g({lc});
+		for (auto i: subset) g = reduce(mul(g, m_lifted[i]), m_modulus);
+		for (auto& c: g) c = mod_symmetric(c, m_modulus);
+		Integer cont = content(g);
+		for (auto& c: g) c = carl::quotient(c, cont);
+		if (exact_quotient(m_f, g)) return g;
+		return std::nullopt;
+	}
+
+	/// Finds the first subset of the given size, in lexicographic order, whose candidate divides f.
+	std::optional<std::pair<std::vector<std::size_t>, IntPoly<Integer>>> find_factor(std::size_t size) const {
+		std::size_t threads = m_parallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+		SubsetEnumerator subsets(m_lifted.size(), size);
+		while (subsets.valid()) {
+			std::vector<std::vector<std::size_t>> batch;
+			for (; subsets.valid() && batch.size() < 64 * threads; ++subsets) batch.push_back(*subsets);
+			std::vector<std::optional<IntPoly<Integer>>> results(batch.size());
+			auto check_range = [&](std::size_t begin, std::size_t end) {
+				for (std::size_t k = begin; k < end; ++k) {
+					results[k] = try_subset(batch[k]);
+					if (results[k]) return;
+				}
+			};
+			std::size_t workers = std::min(threads, batch.size());
+			if (workers > 1) {
+				std::vector<std::future<void>> tasks;
+				std::size_t chunk = (batch.size() + workers - 1) / workers;
+				for (std::size_t begin = 0; begin < batch.size(); begin += chunk) {
+					tasks.emplace_back(std::async(std::launch::async, check_range, begin, std::min(begin + chunk, batch.size())));
+				}
+				for (auto& t: tasks) t.get();
+			} else {
+				check_range(0, batch.size());
+			}
+			for (std::size_t k = 0; k < batch.size(); ++k) {
+				if (results[k]) return std::make_pair(std::move(batch[k]), std::move(*results[k]));
+			}
+		}
+		return std::nullopt;
+	}
+
+public:
+	Recombination(IntPoly<Integer> f, std::vector<IntPoly<Integer>> lifted, Integer modulus, bool parallel):
+		m_f(std::move(f)), m_lifted(std::move(lifted)), m_modulus(std::move(modulus)), m_parallel(parallel) {}
+
+	std::vector<IntPoly<Integer>> operator()() {
+		std::vector<IntPoly<Integer>> res;
+		std::size_t size = 1;
+		while (2 * size <= m_lifted.size()) {
+			auto found = find_factor(size);
+			if (!found) {
+				++size;
+				continue;
+			}
+			auto& [subset, g] = *found;
+			m_f = *exact_quotient(m_f, g);
+			for (auto it = subset.rbegin(); it != subset.rend(); ++it) {
+				m_lifted.erase(m_lifted.begin() + static_cast<std::ptrdiff_t>(*it));
+			}
+			res.emplace_back(std::move(g));
+		}
+		res.emplace_back(std::move(m_f));
+		return res;
+	}
+};
+
+/// Number of primes the modular factorization is computed for.
+static constexpr std::size_t prime_trials = 5;
+
+/**
+ * Computes the irreducible factors of a primitive squarefree polynomial f of positive degree with positive leading coefficient.
+ * If parallel is set, the modular factorizations and the recombination are computed concurrently.
+ * The result does not depend on parallel.
+ */
+template<typename Integer>
+std::vector<IntPoly<Integer>> factor_squarefree(IntPoly<Integer> f, bool parallel) {
+	assert(f.size() > 1 && f.back() > 0);
+	std::vector<IntPoly<Integer>> res;
+	if (carl::is_zero(f.front())) {
+		f.erase(f.begin());
+		res.push_back({Integer(0), Integer(1)});
+		if (f.size() == 1) return res;
+	}
+	if (f.size() == 2) {
+		res.emplace_back(std::move(f));
+		return res;
+	}
+	std::size_t degree = f.size() - 1;
+
+	// Choose primes that keep the degree and the squarefreeness of f.
+	std::vector<PrimeField> fields;
+	PrimeFactory<carl::uint> primes;
+	for (std::size_t id = 1; fields.size() < prime_trials; ++id) {
+		carl::uint p = primes[id];
+		if (p <= std::max<std::size_t>(degree, 10)) continue;
+		PrimeField field(p);
+		ModPoly fp = to_mod(f, field);
+		if (fp.size() != f.size()) continue;
+		if (field.gcd(fp, field.derivative(fp)).size() != 1) continue;
+		fields.push_back(field);
+	}
+	std::vector<std::vector<ModPoly>> modular(fields.size());
+	auto factor_mod = [&](std::size_t k) {
+		modular[k] = fields[k].factor(fields[k].monic(to_mod(f, fields[k])));
+	};
+	if (parallel) {
+		std::vector<std::future<void>> tasks;
+		for (std::size_t k = 0; k < fields.size(); ++k) tasks.emplace_back(std::async(std::launch::async, factor_mod, k));
+		for (auto& t: tasks) t.get();
+	} else {
+		for (std::size_t k = 0; k < fields.size(); ++k) factor_mod(k);
+	}
+	std::size_t best = 0;
+	for (std::size_t k = 1; k < fields.size(); ++k) {
+		if (modular[k].size() < modular[best].size()) best = k;
+	}
+	CARL_LOG_DEBUG("carl.core.upoly", "Using " << modular[best].size() << " modular factors for p = " << fields[best].p());
+	if (modular[best].size() == 1) {
+		res.emplace_back(std::move(f));
+		return res;
+	}
+
+	// Coefficients of a factor g of f, multiplied by lc(f), are bounded by |lc(f)| * 2^deg(f) * sqrt(deg(f)+1) * max|f_i|.
+	Integer maxcoeff(0);
+	for (const auto& c: f) maxcoeff = std::max(maxcoeff, Integer(carl::abs(c)));
+	std::size_t bits = carl::bitsize(f.back()) + degree + (carl::bitsize(Integer(degree + 1)) + 1) / 2 + carl::bitsize(maxcoeff) + 1;
+	// The modulus must exceed twice this bound, i.e. 2^bits.
+	Integer modulus(fields[best].p());
+	std::size_t steps = 0;
+	while (carl::bitsize(modulus) <= bits + 1) {
+		modulus *= modulus;
+		++steps;
+	}
+	auto lifted = hensel_lift(f, fields[best], modular[best], steps, modulus);
+	for (auto& g: Recombination<Integer>(std::move(f), std::move(lifted), modulus, parallel)()) {
+		res.emplace_back(std::move(g));
+	}
+	return res;
+}
+
+}
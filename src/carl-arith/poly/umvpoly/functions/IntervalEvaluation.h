@@ -1,5 +1,6 @@
 #pragma once
 #include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBox.h>
 #include <carl-arith/interval/power.h>
 
 #include "../Monomial.h"
@@ -92,4 +93,38 @@ inline Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const st
 	return res;
 }
 
+inline Interval<double> evaluate(const Monomial& m, const IntervalBox& box)
+{
+	Interval<double> result(1);
+	for (const auto& [var, exp]: m) {
+		CARL_LOG_ASSERT("carl.core.intervalevaluation", box.has(var), "Every variable is expected to be in the box.");
+		result *= carl::pow(box.interval(var), exp);
+		if (result.is_zero())
+			return result;
+	}
+	return result;
+}
+
+template<typename Coeff>
+inline Interval<double> evaluate(const Term<Coeff>& t, const IntervalBox& box)
+{
+	Interval<double> result(t.coeff());
+	if (t.monomial())
+		result *= evaluate(*t.monomial(), box);
+	return result;
+}
+
+template<typename Coeff, typename Policy, typename Ordering>
+inline Interval<double> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const IntervalBox& box)
+{
+	CARL_LOG_FUNC("carl.core.intervalevaluation", p << ", " << box);
+	Interval<double> result(0);
+	for (const auto& t: p) {
+		result += evaluate(t, box);
+		if (result.is_infinite())
+			return result;
+	}
+	return result;
+}
+
 } //Namespace carl
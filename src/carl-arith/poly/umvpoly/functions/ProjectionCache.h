@@ -0,0 +1,149 @@
+/**
+ * @file ProjectionCache.h
+ * @ingroup upoly
+ */
+
+#pragma once
+
+#include "ProjectionCacheStatistics.h"
+
+#include <carl-common/datastructures/MemoizingCache.h>
+#include <carl-common/util/hash.h>
+
+#include <memory>
+#include <vector>
+
+namespace carl {
+
+namespace detail_projection_cache {
+
+template<typename Coeff>
+struct PairKey {
+	UnivariatePolynomial<Coeff> first;
+	UnivariatePolynomial<Coeff> second;
+	SubresultantStrategy strategy;
+	bool operator==(const PairKey& rhs) const {
+		return strategy == rhs.strategy && first == rhs.first && second == rhs.second;
+	}
+	struct Hash {
+		std::size_t operator()(const PairKey& key) const {
+			return carl::hash_all(key.first, key.second, static_cast<int>(key.strategy));
+		}
+	};
+};
+
+template<typename Coeff>
+struct SingleKey {
+	UnivariatePolynomial<Coeff> poly;
+	SubresultantStrategy strategy;
+	bool operator==(const SingleKey& rhs) const {
+		return strategy == rhs.strategy && poly == rhs.poly;
+	}
+	struct Hash {
+		std::size_t operator()(const SingleKey& key) const {
+			return carl::hash_all(key.poly, static_cast<int>(key.strategy));
+		}
+	};
+};
+
+}
+
+/**
+ * Memoizes resultants, discriminants and principal subresultant coefficients.
+ *
+ * Projection operators ask for the same resultants and discriminants over and over again.
+ * A cache can either be queried directly, or installed globally via set_global(): then resultant(),
+ * discriminant() and principalSubresultantsCoefficients() answer from this cache.
+ *
+ * Entries are identified by the polynomials and the strategy.
+ * Resultants are order-insensitive: resultant(q, p) is answered from resultant(p, q), fixing the sign if necessary.
+ * Every kind of entry is bounded by the capacity, the least recently used entries are evicted first.
+ * All methods are thread-safe, see MemoizingCache.
+ * If carl is built with statistics, hits and misses are reported as "projection_cache".
+ * @ingroup upoly
+ */
+template<typename Coeff>
+class ProjectionCache: public GlobalInstance<ProjectionCache<Coeff>> {
+	using Polynomial = UnivariatePolynomial<Coeff>;
+	using PairKey = detail_projection_cache::PairKey<Coeff>;
+	using SingleKey = detail_projection_cache::SingleKey<Coeff>;
+
+	MemoizingCache<PairKey, const Polynomial, typename PairKey::Hash> mResultants;
+	MemoizingCache<SingleKey, const Polynomial, typename SingleKey::Hash> mDiscriminants;
+	MemoizingCache<PairKey, const std::vector<Polynomial>, typename PairKey::Hash> mPSCs;
+
+	void count_evictions(std::size_t evicted) {
+		CARL_CALL_STATISTICS(projection_cache::statistics().evictions += evicted);
+		(void)evicted;
+	}
+public:
+	/**
+	 * @param capacity Maximum number of entries for each kind of query.
+	 */
+	explicit ProjectionCache(std::size_t capacity = 10000):
+		mResultants(capacity), mDiscriminants(capacity), mPSCs(capacity)
+	{}
+
+	Polynomial resultant(const Polynomial& p, const Polynomial& q, SubresultantStrategy strategy = SubresultantStrategy::Default) {
+		bool swapped = q < p;
+		PairKey key{swapped ? q : p, swapped ? p : q, strategy};
+		auto cached = mResultants.find(key);
+		if (cached) {
+			CARL_CALL_STATISTICS(++projection_cache::statistics().resultant_hits);
+		} else {
+			CARL_CALL_STATISTICS(++projection_cache::statistics().resultant_misses);
+			cached = std::make_shared<const Polynomial>(detail_resultant::compute_resultant(key.first, key.second, strategy));
+			count_evictions(mResultants.insert(key, cached));
+		}
+		// For polynomials of the same odd degree, swapping the arguments negates the resultant.
+		if (swapped && p.degree() == q.degree() && p.degree() % 2 == 1) {
+			return -*cached;
+		}
+		return *cached;
+	}
+
+	Polynomial discriminant(const Polynomial& p, SubresultantStrategy strategy = SubresultantStrategy::Default) {
+		SingleKey key{p, strategy};
+		if (auto cached = mDiscriminants.find(key)) {
+			CARL_CALL_STATISTICS(++projection_cache::statistics().discriminant_hits);
+			return *cached;
+		}
+		CARL_CALL_STATISTICS(++projection_cache::statistics().discriminant_misses);
+		auto res = std::make_shared<const Polynomial>(detail_resultant::compute_discriminant(p, strategy));
+		count_evictions(mDiscriminants.insert(key, res));
+		return *res;
+	}
+
+	std::vector<Polynomial> principalSubresultantsCoefficients(const Polynomial& p, const Polynomial& q, SubresultantStrategy strategy = SubresultantStrategy::Default) {
+		PairKey key{p, q, strategy};
+		if (auto cached = mPSCs.find(key)) {
+			CARL_CALL_STATISTICS(++projection_cache::statistics().psc_hits);
+			return *cached;
+		}
+		CARL_CALL_STATISTICS(++projection_cache::statistics().psc_misses);
+		auto res = std::make_shared<const std::vector<Polynomial>>(detail_resultant::compute_principal_subresultants_coefficients(p, q, strategy));
+		count_evictions(mPSCs.insert(key, res));
+		return *res;
+	}
+
+	/// Number of queries answered from the cache.
+	std::size_t hits() const {
+		return mResultants.hits() + mDiscriminants.hits() + mPSCs.hits();
+	}
+	/// Number of queries that were computed.
+	std::size_t misses() const {
+		return mResultants.misses() + mDiscriminants.misses() + mPSCs.misses();
+	}
+	/// Number of cached entries.
+	std::size_t size() const {
+		return mResultants.entries() + mDiscriminants.entries() + mPSCs.entries();
+	}
+
+	void clear() {
+		mResultants.clear();
+		mDiscriminants.clear();
+		mPSCs.clear();
+	}
+};
+
+}
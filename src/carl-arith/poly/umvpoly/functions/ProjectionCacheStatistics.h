@@ -0,0 +1,46 @@
+#pragma once
+
+#include <carl-statistics/carl-statistics.h>
+
+#ifdef CARL_DEVOPTION_Statistics
+
+#include <atomic>
+
+namespace carl {
+namespace projection_cache {
+
+class ProjectionCacheStatistics : public statistics::Statistics {
+	static double rate(std::size_t hits, std::size_t misses) {
+		if (hits + misses == 0) return 0;
+		return static_cast<double>(hits) / static_cast<double>(hits + misses);
+	}
+public:
+	std::atomic<std::size_t> resultant_hits = 0;
+	std::atomic<std::size_t> resultant_misses = 0;
+	std::atomic<std::size_t> discriminant_hits = 0;
+	std::atomic<std::size_t> discriminant_misses = 0;
+	std::atomic<std::size_t> psc_hits = 0;
+	std::atomic<std::size_t> psc_misses = 0;
+	std::atomic<std::size_t> evictions = 0;
+	void collect() {
+		Statistics::addKeyValuePair("resultant_hits", resultant_hits.load());
+		Statistics::addKeyValuePair("resultant_misses", resultant_misses.load());
+		Statistics::addKeyValuePair("resultant_hit_rate", rate(resultant_hits, resultant_misses));
+		Statistics::addKeyValuePair("discriminant_hits", discriminant_hits.load());
+		Statistics::addKeyValuePair("discriminant_misses", discriminant_misses.load());
+		Statistics::addKeyValuePair("discriminant_hit_rate", rate(discriminant_hits, discriminant_misses));
+		Statistics::addKeyValuePair("psc_hits", psc_hits.load());
+		Statistics::addKeyValuePair("psc_misses", psc_misses.load());
+		Statistics::addKeyValuePair("psc_hit_rate", rate(psc_hits, psc_misses));
+		Statistics::addKeyValuePair("evictions", evictions.load());
+	}
+};
+
+static auto& statistics() {
+	static CARL_INIT_STATISTICS(ProjectionCacheStatistics, stats, "projection_cache");
+	return stats;
+}
+
+}
+}
+#endif
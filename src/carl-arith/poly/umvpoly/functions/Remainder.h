@@ -4,9 +4,12 @@
 #include "Quotient.h"
 #include "to_univariate_polynomial.h"
 
+#include "../Geobucket.h"
 #include "../MultivariatePolynomial.h"
 #include "../UnivariatePolynomial.h"
 
+#include <algorithm>
+
 namespace carl {
 
 /**
@@ -178,36 +181,43 @@ MultivariatePolynomial<C,O,P> remainder(const MultivariatePolynomial<C,O,P>& div
 		return MultivariatePolynomial<C,O,P>();
 	}
 
-	MultivariatePolynomial<C,O,P> remainder;
-	MultivariatePolynomial p = dividend;
-	while(!carl::is_zero(p))
+	// Terms of the remainder are found in descending order.
+	std::vector<Term<C>> terms;
+	Geobucket<MultivariatePolynomial<C,O,P>> p(dividend);
+	while(!p.empty())
 	{
 		if(p.lterm().tdeg() < divisor.lterm().tdeg())
 		{
 			assert(!p.lterm().divisible(divisor.lterm()));
 			if( O::degreeOrder )
 			{
-				remainder += p;
-                assert(remainder.is_consistent());
-				return remainder;
+				// No term of p is divisible anymore.
+				break;
 			}
-			remainder += p.lterm();
+			terms.push_back(p.lterm());
 			p.strip_lterm();
 		}
 		else
 		{
 			Term<C> factor;
 			if (p.lterm().divide(divisor.lterm(), factor)) {
-				p.subtractProduct(factor, divisor);
-				//p -= factor * divisor;
+				p.strip_lterm();
+				// The leading terms cancel, hence only the tail of the divisor is subtracted.
+				p.add(-factor, divisor, 1);
 			}
 			else
 			{
-				remainder += p.lterm();
+				terms.push_back(p.lterm());
 				p.strip_lterm();
 			}
 		}
 	}
+	std::reverse(terms.begin(), terms.end());
+	MultivariatePolynomial<C,O,P> remainder(std::move(terms), false, true);
+	if(!p.empty())
+	{
+		remainder += p.to_polynomial();
+	}
 	assert(remainder.is_consistent());
 	assert(dividend == quotient(dividend, divisor) * divisor + remainder);
 	return remainder;
@@ -7,16 +7,28 @@
 #include "Power.h"
 #include "PrimitivePart.h"
 #include "Remainder.h"
+#include "Substitution.h"
 #include "to_univariate_polynomial.h"
 
+#include <carl-common/config.h>
+
+#include <algorithm>
+#include <future>
 #include <list>
+#include <thread>
 #include <vector>
 
 namespace carl {
+/**
+ * Strategies for the computation of subresultants and resultants.
+ * Interpolation only applies to resultants (and discriminants) of polynomials with polynomial coefficients over a field.
+ * In all other cases, it falls back to the default strategy.
+ */
 enum class SubresultantStrategy {
 	Generic,
 	Lazard,
 	Ducos,
+	Interpolation,
 	Default = Lazard
 };
 
@@ -63,6 +75,10 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 	 */
 	assert(pol1.main_var() == pol2.main_var());
 	CARL_LOG_TRACE("carl.core.resultant", "subresultants(" << pol1 << ", " << pol2 << ")");
+	if (strategy == SubresultantStrategy::Interpolation) {
+		// The full subresultant sequence is not interpolated.
+		strategy = SubresultantStrategy::Default;
+	}
 	std::list<UnivariatePolynomial<Coeff>> subresultants;
 	Variable variable = pol1.main_var();
 
@@ -154,7 +170,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 				break;
 			}
 			case SubresultantStrategy::Ducos:
-			case SubresultantStrategy::Lazard: {
+			case SubresultantStrategy::Lazard:
+			case SubresultantStrategy::Interpolation: {
 				CARL_LOG_TRACE("carl.core.resultant", "Part 2: Ducos/Lazard strategy");
 				// "dichotomous Lazard": efficient exponentiation
 				uint deltaReduced = delta - 1;
@@ -211,7 +228,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 		switch (strategy) {
 		// Compared to [Duc98], here S_{d-1} is b and S_d is a, S_e is c, and s_d is subresLcoeff.
 		case SubresultantStrategy::Generic:
-		case SubresultantStrategy::Lazard: {
+		case SubresultantStrategy::Lazard:
+		case SubresultantStrategy::Interpolation: {
 			CARL_LOG_TRACE("carl.core.resultant", "Part 3: Generic/Lazard strategy");
 			if (carl::is_zero(p)) return subresultants;
 
@@ -269,8 +287,135 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 	}
 }
 
+namespace detail_resultant {
+
+/**
+ * Computes the resultant of p and q using the default subresultant strategy.
+ * @return The resultant as a coefficient.
+ */
 template<typename Coeff>
-std::vector<UnivariatePolynomial<Coeff>> principalSubresultantsCoefficients(
+Coeff resultant_coefficient(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q) {
+	UnivariatePolynomial<Coeff> res = subresultants(p, q, SubresultantStrategy::Default).front();
+	if (is_constant(res)) return res.lcoeff();
+	return Coeff(0);
+}
+
+/**
+ * Specializes all coefficients of p at var = value.
+ */
+template<typename Coeff, typename Number>
+UnivariatePolynomial<Coeff> specialize(const UnivariatePolynomial<Coeff>& p, Variable var, const Number& value) {
+	std::map<Variable, Number> assignment = {{var, value}};
+	std::vector<Coeff> coeffs;
+	coeffs.reserve(p.coefficients().size());
+	for (const auto& c: p.coefficients()) {
+		coeffs.emplace_back(carl::substitute(c, assignment));
+	}
+	return UnivariatePolynomial<Coeff>(p.main_var(), std::move(coeffs));
+}
+
+/**
+ * Computes the resultant of p and q by evaluation and interpolation, see e.g. @cite GCL92, chapter 9.
+ *
+ * The variables vars[i..] occurring in the coefficients are eliminated one after another:
+ * p and q are specialized at sufficiently many integers, the resultants of the specialized polynomials are
+ * computed recursively and the resultant is obtained by Newton interpolation.
+ * Only points where neither leading coefficient vanishes are used, hence the degrees are kept and the resultant
+ * of the specialized polynomials is the specialization of the resultant.
+ * The number of points follows from the bound deg_y(res(p,q)) <= deg(p) * deg_y(q) + deg(q) * deg_y(p).
+ *
+ * The specializations are independent of each other. If parallel is set, they are computed concurrently.
+ * @param p First polynomial, not constant.
+ * @param q Second polynomial, not constant.
+ * @param vars Variables occurring in the coefficients.
+ * @param i Index of the next variable to eliminate.
+ * @param parallel Flag whether the specializations are computed concurrently.
+ * @return The resultant as a coefficient.
+ */
+template<typename Coeff>
+Coeff resultant_interpolation(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q, const std::vector<Variable>& vars, std::size_t i, bool parallel) {
+	using Number = typename UnderlyingNumberType<Coeff>::type;
+	if (i == vars.size()) {
+		return resultant_coefficient(p, q);
+	}
+	Variable var = vars[i];
+	std::size_t degP = 0;
+	std::size_t degQ = 0;
+	for (const auto& c: p.coefficients()) degP = std::max(degP, c.degree(var));
+	for (const auto& c: q.coefficients()) degQ = std::max(degQ, c.degree(var));
+	if (degP == 0 && degQ == 0) {
+		return resultant_interpolation(p, q, vars, i + 1, parallel);
+	}
+	std::size_t bound = p.degree() * degQ + q.degree() * degP;
+	CARL_LOG_TRACE("carl.core.resultant", "Interpolating resultant in " << var << " with degree bound " << bound);
+
+	// Select integers 0, 1, -1, 2, -2, ... that keep the leading coefficients.
+	std::vector<Number> points;
+	for (long n = 0; points.size() <= bound; n = (n > 0) ? -n : -n + 1) {
+		std::map<Variable, Number> assignment = {{var, Number(n)}};
+		if (carl::is_zero(carl::substitute(p.lcoeff(), assignment))) continue;
+		if (carl::is_zero(carl::substitute(q.lcoeff(), assignment))) continue;
+		points.emplace_back(n);
+	}
+
+	std::vector<Coeff> values(points.size());
+	auto evaluate_range = [&](std::size_t begin, std::size_t end) {
+		for (std::size_t k = begin; k < end; ++k) {
+			values[k] = resultant_interpolation(specialize(p, var, points[k]), specialize(q, var, points[k]), vars, i + 1, false);
+		}
+	};
+	std::size_t threads = parallel ? std::min<std::size_t>(std::thread::hardware_concurrency(), points.size()) : 1;
+	if (threads > 1) {
+		std::vector<std::future<void>> tasks;
+		std::size_t chunk = (points.size() + threads - 1) / threads;
+		for (std::size_t begin = 0; begin < points.size(); begin += chunk) {
+			tasks.emplace_back(std::async(std::launch::async, evaluate_range, begin, std::min(begin + chunk, points.size())));
+		}
+		for (auto& t: tasks) t.get();
+	} else {
+		evaluate_range(0, points.size());
+	}
+
+	// Newton interpolation: compute the divided differences in place.
+	for (std::size_t k = 1; k < points.size(); ++k) {
+		for (std::size_t j = points.size() - 1; j >= k; --j) {
+			values[j] = (values[j] - values[j - 1]) / Number(points[j] - points[j - k]);
+		}
+	}
+	Coeff res = values.back();
+	for (std::size_t k = points.size() - 1; k > 0; --k) {
+		res = res * (Coeff(var) - Coeff(points[k - 1])) + values[k - 1];
+	}
+	return res;
+}
+
+/**
+ * Computes the resultant of p and q by evaluation and interpolation, if this is applicable.
+ * Otherwise, the default subresultant strategy is used.
+ */
+template<typename Coeff>
+UnivariatePolynomial<Coeff> resultant_interpolation(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q) {
+	if constexpr (is_polynomial_type<Coeff>::value && is_field_type<typename UnderlyingNumberType<Coeff>::type>::value) {
+		if (!is_constant(p) && !is_constant(q)) {
+			carlVariables vars;
+			for (const auto& c: p.coefficients()) variables(c, vars);
+			for (const auto& c: q.coefficients()) variables(c, vars);
+			std::vector<Variable> order(vars.begin(), vars.end());
+#ifdef THREAD_SAFE
+			bool parallel = true;
+#else
+			bool parallel = false;
+#endif
+			return UnivariatePolynomial<Coeff>(p.main_var(), resultant_interpolation(p, q, order, 0, parallel));
+		}
+	}
+	UnivariatePolynomial<Coeff> res = subresultants(p, q, SubresultantStrategy::Default).front();
+	if (is_constant(res)) return res;
+	return UnivariatePolynomial<Coeff>(p.main_var());
+}
+
+template<typename Coeff>
+std::vector<UnivariatePolynomial<Coeff>> compute_principal_subresultants_coefficients(
 	const UnivariatePolynomial<Coeff>& p,
 	const UnivariatePolynomial<Coeff>& q,
 	SubresultantStrategy strategy) {
@@ -286,12 +431,17 @@ std::vector<UnivariatePolynomial<Coeff>> principalSubresultantsCoefficients(
 }
 
 template<typename Coeff>
-UnivariatePolynomial<Coeff> resultant(
+UnivariatePolynomial<Coeff> compute_resultant(
 	const UnivariatePolynomial<Coeff>& p,
 	const UnivariatePolynomial<Coeff>& q,
 	SubresultantStrategy strategy) {
 	assert(p.main_var() == q.main_var());
 	if (carl::is_zero(p) || carl::is_zero(q)) return UnivariatePolynomial<Coeff>(p.main_var());
+	if (strategy == SubresultantStrategy::Interpolation) {
+		UnivariatePolynomial<Coeff> res = resultant_interpolation(p.normalized(), q.normalized());
+		CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << res);
+		return res;
+	}
 
 	UnivariatePolynomial<Coeff> res = subresultants(p.normalized(), q.normalized(), strategy).front();
 
@@ -304,10 +454,10 @@ UnivariatePolynomial<Coeff> resultant(
 }
 
 template<typename Coeff>
-UnivariatePolynomial<Coeff> discriminant(
+UnivariatePolynomial<Coeff> compute_discriminant(
 	const UnivariatePolynomial<Coeff>& p,
 	SubresultantStrategy strategy) {
-	UnivariatePolynomial<Coeff> res = resultant(p, derivative(p), strategy);
+	UnivariatePolynomial<Coeff> res = compute_resultant(p, derivative(p), strategy);
 	if (res.is_number()) return res;
 	uint d = p.degree();
 	Coeff sign = ((d * (d - 1) / 2) % 2 == 0) ? Coeff(1) : Coeff(-1);
@@ -318,6 +468,46 @@ UnivariatePolynomial<Coeff> discriminant(
 	return res;
 }
 
+} // namespace detail_resultant
+
+} // namespace carl
+
+#include "ProjectionCache.h"
+
+namespace carl {
+
+template<typename Coeff>
+std::vector<UnivariatePolynomial<Coeff>> principalSubresultantsCoefficients(
+	const UnivariatePolynomial<Coeff>& p,
+	const UnivariatePolynomial<Coeff>& q,
+	SubresultantStrategy strategy) {
+	if (auto* cache = ProjectionCache<Coeff>::global()) {
+		return cache->principalSubresultantsCoefficients(p, q, strategy);
+	}
+	return detail_resultant::compute_principal_subresultants_coefficients(p, q, strategy);
+}
+
+template<typename Coeff>
+UnivariatePolynomial<Coeff> resultant(
+	const UnivariatePolynomial<Coeff>& p,
+	const UnivariatePolynomial<Coeff>& q,
+	SubresultantStrategy strategy) {
+	if (auto* cache = ProjectionCache<Coeff>::global()) {
+		return cache->resultant(p, q, strategy);
+	}
+	return detail_resultant::compute_resultant(p, q, strategy);
+}
+
+template<typename Coeff>
+UnivariatePolynomial<Coeff> discriminant(
+	const UnivariatePolynomial<Coeff>& p,
+	SubresultantStrategy strategy) {
+	if (auto* cache = ProjectionCache<Coeff>::global()) {
+		return cache->discriminant(p, strategy);
+	}
+	return detail_resultant::compute_discriminant(p, strategy);
+}
+
 namespace resultant_debug {
 /**
 	 * A reimplementation of the resultant algorithm from z3.
@@ -2,13 +2,68 @@
 
 #include "Evaluation.h"
 #include "SturmSequence.h"
+#include "SturmSequenceCache.h"
 #include <carl-arith/core/Sign.h>
 #include "../UnivariatePolynomial.h"
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 namespace carl {
 
+/**
+ * Counts the sign variations of a sequence of polynomials at many points at once.
+ * For rational coefficients, every polynomial is scaled to integral coefficients once and evaluated at a point a/b as
+ * b^n * p(a/b), which has the same sign as p(a/b). Hence all evaluations only use integer arithmetic.
+ * @param seq Sequence of polynomials, e.g. a Sturm sequence.
+ * @param points Points to evaluate the sequence at.
+ * @return The number of sign variations of the sequence at every point.
+ */
+template<typename Coefficient>
+std::vector<std::size_t> sign_variations_at(const std::vector<UnivariatePolynomial<Coefficient>>& seq, const std::vector<Coefficient>& points) {
+	std::vector<std::vector<Sign>> signs(points.size(), std::vector<Sign>(seq.size(), Sign::ZERO));
+	if constexpr (is_rational_type<Coefficient>::value) {
+		using Integer = typename IntegralType<Coefficient>::type;
+		std::size_t degree = 0;
+		for (const auto& p: seq) {
+			if (!carl::is_zero(p)) degree = std::max<std::size_t>(degree, p.degree());
+		}
+		std::vector<Integer> numerators;
+		std::vector<std::vector<Integer>> denominator_powers;
+		for (const auto& x: points) {
+			numerators.emplace_back(carl::get_num(x));
+			std::vector<Integer> powers(1, Integer(1));
+			for (std::size_t d = 0; d < degree; ++d) powers.emplace_back(powers.back() * carl::get_denom(x));
+			denominator_powers.emplace_back(std::move(powers));
+		}
+		for (std::size_t j = 0; j < seq.size(); ++j) {
+			if (carl::is_zero(seq[j])) continue;
+			// The coprime factor may be negative, e.g. for a negative constant, hence only scale by its absolute value.
+			const auto coeffs = seq[j].coprime_coefficients_sign_preserving().coefficients();
+			std::size_t n = coeffs.size() - 1;
+			for (std::size_t k = 0; k < points.size(); ++k) {
+				Integer value = coeffs[n];
+				for (std::size_t i = n; i-- > 0;) {
+					value = value * numerators[k] + coeffs[i] * denominator_powers[k][n - i];
+				}
+				signs[k][j] = carl::sgn(value);
+			}
+		}
+	} else {
+		for (std::size_t k = 0; k < points.size(); ++k) {
+			for (std::size_t j = 0; j < seq.size(); ++j) {
+				signs[k][j] = carl::sgn(carl::evaluate(seq[j], points[k]));
+			}
+		}
+	}
+	std::vector<std::size_t> res;
+	for (const auto& s: signs) {
+		res.emplace_back(carl::sign_variations(s.begin(), s.end()));
+	}
+	return res;
+}
+
 /**
  * Calculate the number of real roots of a polynomial within a given interval based on a sturm sequence of this polynomial.
  * @param seq Sturm sequence.
@@ -17,17 +72,13 @@ namespace carl {
  */
 template<typename Coefficient>
 int count_real_roots(const std::vector<UnivariatePolynomial<Coefficient>>& seq, const Interval<Coefficient>& i) {
-	int l = static_cast<int>(carl::sign_variations(seq.begin(), seq.end(), 
-		[&i](const auto& p){ return carl::sgn(carl::evaluate(p, i.lower())); }
-	));
-	int r = static_cast<int>(carl::sign_variations(seq.begin(), seq.end(),
-		[&i](const auto& p){ return carl::sgn(carl::evaluate(p, i.upper())); }
-	));
-	return l - r;
+	auto variations = sign_variations_at(seq, {i.lower(), i.upper()});
+	return static_cast<int>(variations[0]) - static_cast<int>(variations[1]);
 }
 
 /**
  * Count the number of real roots of p within the given interval using Sturm sequences.
+ * The Sturm sequence is taken from the global SturmSequenceCache, if one is installed.
  * @param p The polynomial.
  * @param i Count roots within this interval.
  * @return Number of real roots within the interval.
@@ -37,7 +88,7 @@ int count_real_roots(const UnivariatePolynomial<Coefficient>& p, const Interval<
 	assert(!is_zero(p));
 	assert(!carl::is_root_of(p, i.lower()));
 	assert(!carl::is_root_of(p, i.upper()));
-	return count_real_roots(sturm_sequence(p), i);
+	return count_real_roots(*cached_sturm_sequence(p), i);
 }
 
 }
@@ -0,0 +1,115 @@
+/**
+ * @file SturmSequenceCache.h
+ * @ingroup upoly
+ */
+
+#pragma once
+
+#include "SturmSequence.h"
+
+#include <carl-common/datastructures/MemoizingCache.h>
+#include <carl-common/util/hash.h>
+
+#include <memory>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Memoizes Sturm sequences.
+ *
+ * Root counting and the refinement of real algebraic numbers evaluate the Sturm sequences of the same polynomials
+ * over and over again. A cache can either be queried directly, or installed globally via set_global(): then
+ * cached_sturm_sequence() and count_real_roots() answer from this cache.
+ *
+ * Entries are identified by the pair of polynomials the sequence starts with. The cache is bounded by the total number
+ * of coefficients of all stored sequences, the least recently used sequences are evicted first.
+ * All methods are thread-safe, see MemoizingCache.
+ * @ingroup upoly
+ */
+template<typename Coeff>
+class SturmSequenceCache: public GlobalInstance<SturmSequenceCache<Coeff>> {
+public:
+	using Polynomial = UnivariatePolynomial<Coeff>;
+	using Sequence = std::shared_ptr<const std::vector<Polynomial>>;
+private:
+	using Key = std::pair<Polynomial, Polynomial>;
+	struct KeyHash {
+		std::size_t operator()(const Key& key) const {
+			return carl::hash_all(key.first, key.second);
+		}
+	};
+
+	MemoizingCache<Key, const std::vector<Polynomial>, KeyHash> mSequences;
+
+	static std::size_t size_of(const std::vector<Polynomial>& seq) {
+		std::size_t res = 0;
+		for (const auto& p: seq) res += p.coefficients().size();
+		return res;
+	}
+public:
+	/**
+	 * @param capacity Maximum total number of coefficients of all stored sequences.
+	 */
+	explicit SturmSequenceCache(std::size_t capacity = 1000000):
+		mSequences(capacity, &size_of)
+	{}
+
+	/// Returns the Sturm sequence of p and q, see sturm_sequence(p, q).
+	Sequence get(const Polynomial& p, const Polynomial& q) {
+		return mSequences.get(Key(p, q), [&]() {
+			return std::make_shared<const std::vector<Polynomial>>(sturm_sequence(p, q));
+		});
+	}
+	/// Returns the Sturm sequence of p, see sturm_sequence(p).
+	Sequence get(const Polynomial& p) {
+		return get(p, derivative(p));
+	}
+
+	/// Changes the capacity, evicting sequences if necessary.
+	void set_capacity(std::size_t capacity) {
+		mSequences.set_capacity(capacity);
+	}
+
+	void clear() {
+		mSequences.clear();
+	}
+
+	/// Number of sequences in the cache.
+	std::size_t entries() const {
+		return mSequences.entries();
+	}
+	/// Total number of coefficients of the sequences in the cache.
+	std::size_t size() const {
+		return mSequences.size();
+	}
+	std::size_t hits() const {
+		return mSequences.hits();
+	}
+	std::size_t misses() const {
+		return mSequences.misses();
+	}
+};
+
+/**
+ * Returns the Sturm sequence of p and q, see sturm_sequence(p, q).
+ * If a SturmSequenceCache is installed globally, the sequence is taken from the cache.
+ */
+template<typename Coeff>
+typename SturmSequenceCache<Coeff>::Sequence cached_sturm_sequence(const UnivariatePolynomial<Coeff>& p, const UnivariatePolynomial<Coeff>& q) {
+	if (auto* cache = SturmSequenceCache<Coeff>::global()) {
+		return cache->get(p, q);
+	}
+	return std::make_shared<const std::vector<UnivariatePolynomial<Coeff>>>(sturm_sequence(p, q));
+}
+
+/**
+ * Returns the Sturm sequence of p, see sturm_sequence(p).
+ * If a SturmSequenceCache is installed globally, the sequence is taken from the cache.
+ */
+template<typename Coeff>
+typename SturmSequenceCache<Coeff>::Sequence cached_sturm_sequence(const UnivariatePolynomial<Coeff>& p) {
+	return cached_sturm_sequence(p, derivative(p));
+}
+
+}
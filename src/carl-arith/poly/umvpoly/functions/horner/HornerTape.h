@@ -0,0 +1,200 @@
+/**
+ * @file	HornerTape.h
+ *
+ * A flattened representation of a MultivariateHorner scheme.
+ */
+
+#pragma once
+
+#include <carl-arith/core/Variable.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBox.h>
+#include <carl-arith/interval/power.h>
+#include <carl-arith/numbers/numbers.h>
+#include <carl-arith/poly/umvpoly/functions/DensePolynomial.h>
+
+#include <map>
+#include <vector>
+
+namespace carl {
+
+template<typename PolynomialType, class strategy>
+class MultivariateHorner;
+
+/**
+ * A Horner scheme compiled to a linear sequence of instructions on registers.
+ *
+ * Every instruction writes a fresh register, hence the tape is in SSA form.
+ * Inputs are dense: the i'th input is the value of the i'th variable of variables().
+ * The tape can be evaluated on doubles and on double intervals, evaluation does not allocate if the caller provides the registers.
+ */
+class HornerTape {
+public:
+	enum class OpCode { CONST, VAR, POW, MUL, ADD };
+	struct Instruction {
+		OpCode op;
+		/// Index of the constant, of the variable or of the first operand register.
+		std::size_t a;
+		/// Exponent or index of the second operand register.
+		std::size_t b;
+	};
+private:
+	std::vector<Instruction> mTape;
+	DenseVariables mVariables;
+	std::vector<double> mConstants;
+	std::vector<Interval<double>> mIntervalConstants;
+	std::size_t mResult = 0;
+
+	static double power(double base, std::size_t exp) {
+		double res = 1;
+		for (; exp > 0; exp /= 2) {
+			if (exp % 2 == 1) res *= base;
+			base *= base;
+		}
+		return res;
+	}
+	static Interval<double> power(const Interval<double>& base, std::size_t exp) {
+		return carl::pow(base, static_cast<uint>(exp));
+	}
+	const double& constant(std::size_t i, const double*) const {
+		return mConstants[i];
+	}
+	const Interval<double>& constant(std::size_t i, const Interval<double>*) const {
+		return mIntervalConstants[i];
+	}
+
+	std::size_t emit(OpCode op, std::size_t a, std::size_t b = 0) {
+		mTape.push_back(Instruction{op, a, b});
+		return mTape.size() - 1;
+	}
+	template<typename Coeff>
+	std::size_t emit_constant(const Coeff& c) {
+		mConstants.emplace_back(carl::to_double(c));
+		mIntervalConstants.emplace_back(c);
+		return emit(OpCode::CONST, mConstants.size() - 1);
+	}
+	template<typename PolynomialType, class strategy>
+	std::size_t compile(const MultivariateHorner<PolynomialType, strategy>& mvH, std::map<Variable, std::size_t>& varRegs) {
+		if (mvH.getVariable() == Variable::NO_VARIABLE) {
+			return emit_constant(mvH.getIndepConstant());
+		}
+		auto it = varRegs.find(mvH.getVariable());
+		if (it == varRegs.end()) {
+			it = varRegs.emplace(mvH.getVariable(), emit(OpCode::VAR, mVariables.add(mvH.getVariable()))).first;
+		}
+		std::size_t res = it->second;
+		if (mvH.getExponent() != 1) {
+			res = emit(OpCode::POW, res, mvH.getExponent());
+		}
+		if (mvH.getDependent()) {
+			res = emit(OpCode::MUL, res, compile(*mvH.getDependent(), varRegs));
+		} else if (!is_one(mvH.getDepConstant())) {
+			res = emit(OpCode::MUL, res, emit_constant(mvH.getDepConstant()));
+		}
+		if (mvH.getIndependent()) {
+			res = emit(OpCode::ADD, res, compile(*mvH.getIndependent(), varRegs));
+		} else if (!is_zero(mvH.getIndepConstant())) {
+			res = emit(OpCode::ADD, res, emit_constant(mvH.getIndepConstant()));
+		}
+		return res;
+	}
+public:
+	/**
+	 * Compiles the given Horner scheme.
+	 * Constants are rounded to nearest for double evaluation and enclosed outwards for interval evaluation.
+	 */
+	template<typename PolynomialType, class strategy>
+	explicit HornerTape(const MultivariateHorner<PolynomialType, strategy>& mvH) {
+		std::map<Variable, std::size_t> varRegs;
+		mResult = compile(mvH, varRegs);
+	}
+
+	const std::vector<Instruction>& instructions() const {
+		return mTape;
+	}
+	/// The variables, in the order of the inputs.
+	const std::vector<Variable>& variables() const {
+		return mVariables.variables();
+	}
+	/// Number of registers needed for evaluation.
+	std::size_t registers() const {
+		return mTape.size();
+	}
+
+	/**
+	 * Evaluates the tape on the given inputs, using the given registers.
+	 * @param inputs Values of variables(), in this order.
+	 * @param regs At least registers() many registers.
+	 * @return The value of the Horner scheme.
+	 */
+	template<typename T>
+	T evaluate(const T* inputs, T* regs) const {
+		for (std::size_t i = 0; i < mTape.size(); ++i) {
+			const Instruction& ins = mTape[i];
+			switch (ins.op) {
+				case OpCode::CONST: regs[i] = constant(ins.a, inputs); break;
+				case OpCode::VAR: regs[i] = inputs[ins.a]; break;
+				case OpCode::POW: regs[i] = power(regs[ins.a], ins.b); break;
+				case OpCode::MUL: regs[i] = regs[ins.a] * regs[ins.b]; break;
+				case OpCode::ADD: regs[i] = regs[ins.a] + regs[ins.b]; break;
+			}
+		}
+		return regs[mResult];
+	}
+	template<typename T>
+	T evaluate(const std::vector<T>& inputs) const {
+		assert(inputs.size() == mVariables.size());
+		std::vector<T> regs(registers());
+		return evaluate(inputs.data(), regs.data());
+	}
+	/// Evaluates the tape over the given box, which must contain all variables().
+	Interval<double> evaluate(const IntervalBox& box) const {
+		std::vector<Interval<double>> inputs;
+		inputs.reserve(mVariables.size());
+		mVariables.intervals(box, inputs);
+		return evaluate(inputs);
+	}
+
+	/**
+	 * Evaluates the tape on many inputs, reusing the registers.
+	 * @param inputs count * variables().size() values, one input after another.
+	 * @param count Number of inputs.
+	 * @param results Storage for count results.
+	 */
+	template<typename T>
+	void evaluate_batch(const T* inputs, std::size_t count, T* results) const {
+		std::vector<T> regs(registers());
+		for (std::size_t i = 0; i < count; ++i) {
+			results[i] = evaluate(inputs + i * mVariables.size(), regs.data());
+		}
+	}
+	/// Evaluates the tape over many boxes, which must contain all variables().
+	std::vector<Interval<double>> evaluate_batch(const std::vector<IntervalBox>& boxes) const {
+		std::vector<Interval<double>> inputs;
+		inputs.reserve(boxes.size() * mVariables.size());
+		for (const auto& box: boxes) {
+			mVariables.intervals(box, inputs);
+		}
+		std::vector<Interval<double>> res(boxes.size());
+		evaluate_batch(inputs.data(), boxes.size(), res.data());
+		return res;
+	}
+};
+
+inline std::ostream& operator<<(std::ostream& os, const HornerTape& tape) {
+	for (std::size_t i = 0; i < tape.instructions().size(); ++i) {
+		const auto& ins = tape.instructions()[i];
+		os << "r" << i << " = ";
+		switch (ins.op) {
+			case HornerTape::OpCode::CONST: os << "const " << ins.a; break;
+			case HornerTape::OpCode::VAR: os << tape.variables()[ins.a]; break;
+			case HornerTape::OpCode::POW: os << "r" << ins.a << " ^ " << ins.b; break;
+			case HornerTape::OpCode::MUL: os << "r" << ins.a << " * r" << ins.b; break;
+			case HornerTape::OpCode::ADD: os << "r" << ins.a << " + r" << ins.b; break;
+		}
+		os << std::endl;
+	}
+	return os;
+}
+
+}
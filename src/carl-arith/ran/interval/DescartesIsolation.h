@@ -0,0 +1,293 @@
+#pragma once
+
+#include "../real_roots_common.h"
+
+#include <carl-arith/core/Sign.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/numbers/numbers.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+/**
+ * Real root isolation on integer coefficient vectors based on Descartes' rule of signs.
+ *
+ * Both isolators only search for positive roots of a square-free polynomial p with p(0) != 0, negative roots are
+ * obtained as positive roots of p(-x). Polynomials are given as coefficient vectors, starting with the constant coefficient.
+ * All transformations (Taylor shifts, reversals, scaling by powers of two) work in place and need no divisions.
+ */
+namespace carl::ran::interval::descartes {
+
+/// Replaces p(x) by p(x+1), using the classical quadratic scheme of repeated synthetic division.
+template<typename Integer>
+void taylor_shift_one(std::vector<Integer>& p) {
+	for (std::size_t i = 0; i + 1 < p.size(); ++i) {
+		for (std::size_t j = p.size() - 1; j > i; --j) {
+			p[j - 1] += p[j];
+		}
+	}
+}
+
+/// Replaces p(x) by p(x+s).
+template<typename Integer>
+void taylor_shift(std::vector<Integer>& p, const Integer& s) {
+	for (std::size_t i = 0; i + 1 < p.size(); ++i) {
+		for (std::size_t j = p.size() - 1; j > i; --j) {
+			p[j - 1] += s * p[j];
+		}
+	}
+}
+
+/// Replaces p(x) by 2^n * p(x/2), where n is the degree of p.
+template<typename Integer>
+void halve(std::vector<Integer>& p) {
+	Integer factor(2);
+	for (std::size_t i = p.size() - 1; i > 0; --i) {
+		p[i - 1] *= factor;
+		factor *= 2;
+	}
+}
+
+/// Replaces p(x) by p(2^k * x) for k >= 0 and by 2^(-k*n) * p(2^k * x) for k < 0, where n is the degree of p.
+template<typename Integer>
+void scale_by_power_of_two(std::vector<Integer>& p, long k) {
+	if (k == 0) return;
+	Integer step = carl::pow(Integer(2), std::size_t(std::abs(k)));
+	Integer factor = step;
+	if (k > 0) {
+		for (std::size_t i = 1; i < p.size(); ++i) {
+			p[i] *= factor;
+			factor *= step;
+		}
+	} else {
+		for (std::size_t i = p.size() - 1; i > 0; --i) {
+			p[i - 1] *= factor;
+			factor *= step;
+		}
+	}
+}
+
+/// Replaces p(x) by p(x) / (x - 1), assuming that 1 is a root of p.
+template<typename Integer>
+void divide_by_x_minus_one(std::vector<Integer>& p) {
+	for (std::size_t j = p.size() - 1; j > 0; --j) {
+		p[j - 1] += p[j];
+	}
+	assert(carl::is_zero(p.front()));
+	p.erase(p.begin());
+}
+
+/// Counts the sign variations of the coefficients, stopping as soon as limit is reached.
+template<typename Integer>
+std::size_t count_sign_variations(const std::vector<Integer>& p, std::size_t limit) {
+	std::size_t res = 0;
+	Sign last = Sign::ZERO;
+	for (const auto& c: p) {
+		Sign s = carl::sgn(c);
+		if (s == Sign::ZERO) continue;
+		if (last != Sign::ZERO && s != last) {
+			if (++res >= limit) break;
+		}
+		last = s;
+	}
+	return res;
+}
+
+/**
+ * Computes k such that all positive roots of p are smaller than 2^k.
+ * Uses the bound by Kioustelidis, evaluated on the bit sizes of the coefficients.
+ * Assumes that p has at least one sign variation.
+ */
+template<typename Integer>
+long positive_root_bound(const std::vector<Integer>& p) {
+	assert(count_sign_variations(p, 1) > 0);
+	std::size_t n = p.size() - 1;
+	Sign lc = carl::sgn(p.back());
+	long lc_bits = long(carl::bitsize(carl::abs(p.back())));
+	long res = std::numeric_limits<long>::min();
+	for (std::size_t i = 0; i < n; ++i) {
+		if (carl::is_zero(p[i]) || carl::sgn(p[i]) == lc) continue;
+		// |p[i] / p[n]| < 2^num, hence |p[i] / p[n]|^(1/(n-i)) < 2^ceil(num / (n-i))
+		long num = long(carl::bitsize(carl::abs(p[i]))) - lc_bits + 1;
+		long den = long(n - i);
+		long e = num >= 0 ? (num + den - 1) / den : -((-num) / den);
+		res = std::max(res, e + 1);
+	}
+	return res;
+}
+
+template<typename Number>
+Number power_of_two(long k) {
+	Number res = carl::pow(Number(2), std::size_t(std::abs(k)));
+	return k >= 0 ? res : Number(1) / res;
+}
+
+/**
+ * Isolates the positive roots of p by bisection of (0, 2^k), also known as the Vincent-Collins-Akritas method.
+ *
+ * Every node represents the interval (c/2^d, (c+1)/2^d), scaled by 2^k, by a polynomial whose roots in (0,1)
+ * correspond to the roots within this interval.
+ * The number of roots within the interval is bounded by the sign variations of (x+1)^n * q(1/(x+1)).
+ * The children are obtained by 2^n * q(x/2) and its Taylor shift by one.
+ * @return Open isolating intervals and point intervals for rational roots, unordered.
+ */
+template<typename Number, typename Integer>
+std::vector<Interval<Number>> isolate_positive_roots_vca(std::vector<Integer> p) {
+	std::vector<Interval<Number>> res;
+	assert(!carl::is_zero(p.front()));
+	if (count_sign_variations(p, 1) == 0) return res;
+	long k = positive_root_bound(p);
+	scale_by_power_of_two(p, k);
+	Number scale = power_of_two<Number>(k);
+	auto endpoint = [&scale](const Integer& c, std::size_t depth) {
+		return Number(c) * scale / carl::pow(Number(2), depth);
+	};
+
+	struct Node {
+		std::vector<Integer> poly;
+		Integer c;
+		std::size_t depth;
+		/// Whether the lower resp. upper endpoint is a root that was divided out.
+		bool lower_root;
+		bool upper_root;
+	};
+	std::vector<Node> stack;
+	stack.push_back(Node{std::move(p), Integer(0), 0, false, false});
+	std::vector<Integer> transformed;
+	while (!stack.empty()) {
+		Node node = std::move(stack.back());
+		stack.pop_back();
+		transformed = node.poly;
+		std::reverse(transformed.begin(), transformed.end());
+		taylor_shift_one(transformed);
+		auto variations = count_sign_variations(transformed, 2);
+		if (variations == 0) continue;
+		if (variations == 1 && !node.lower_root && !node.upper_root) {
+			res.emplace_back(endpoint(node.c, node.depth), BoundType::STRICT, endpoint(node.c + 1, node.depth), BoundType::STRICT);
+			continue;
+		}
+		// Endpoints of isolating intervals must not be roots, hence intervals with such endpoints are split further.
+		halve(node.poly);
+		Node right{node.poly, 2 * node.c + 1, node.depth + 1, false, node.upper_root};
+		taylor_shift_one(right.poly);
+		node.c = 2 * node.c;
+		node.depth += 1;
+		node.upper_root = false;
+		if (carl::is_zero(right.poly.front())) {
+			res.emplace_back(endpoint(right.c, right.depth));
+			right.poly.erase(right.poly.begin());
+			divide_by_x_minus_one(node.poly);
+			right.lower_root = true;
+			node.upper_root = true;
+		}
+		stack.push_back(std::move(right));
+		stack.push_back(std::move(node));
+	}
+	return res;
+}
+
+/**
+ * Isolates the positive roots of p by continued fractions, also known as the Vincent-Akritas-Strzebonski method.
+ *
+ * Every node is a polynomial q together with a Moebius transformation M(x) = (ax+b)/(cx+d) such that the positive roots
+ * of q are mapped to the roots of p within (M(0), M(infinity)).
+ * Before splitting at one, q is shifted by a lower bound on its positive roots, which avoids long chains of unit shifts.
+ * @return Open isolating intervals and point intervals for rational roots, unordered.
+ */
+template<typename Number, typename Integer>
+std::vector<Interval<Number>> isolate_positive_roots_vas(std::vector<Integer> p) {
+	std::vector<Interval<Number>> res;
+	assert(!carl::is_zero(p.front()));
+
+	struct Node {
+		std::vector<Integer> poly;
+		Integer a, b, c, d;
+		/// Whether M(0) resp. M(infinity) is a root that was divided out.
+		bool zero_root;
+		bool infinity_root;
+	};
+	auto add_interval = [&res](const Node& node) {
+		Number lower = Number(node.b) / Number(node.d);
+		Number upper;
+		if (carl::is_zero(node.c)) {
+			upper = (Number(node.a) * power_of_two<Number>(positive_root_bound(node.poly)) + Number(node.b)) / Number(node.d);
+		} else {
+			upper = Number(node.a) / Number(node.c);
+		}
+		if (upper < lower) std::swap(lower, upper);
+		res.emplace_back(lower, BoundType::STRICT, upper, BoundType::STRICT);
+	};
+	auto isolated = [](const Node& node, std::size_t variations) {
+		return variations == 1 && !node.zero_root && !node.infinity_root;
+	};
+
+	std::vector<Node> stack;
+	stack.push_back(Node{std::move(p), Integer(1), Integer(0), Integer(0), Integer(1), false, false});
+	std::vector<Integer> reversed;
+	while (!stack.empty()) {
+		Node node = std::move(stack.back());
+		stack.pop_back();
+		auto variations = count_sign_variations(node.poly, 2);
+		if (variations == 0) continue;
+		if (isolated(node, variations)) {
+			add_interval(node);
+			continue;
+		}
+		// Shift by a lower bound 2^-k >= 1 on the positive roots, obtained from an upper bound on the roots of x^n * q(1/x).
+		reversed = node.poly;
+		std::reverse(reversed.begin(), reversed.end());
+		long k = positive_root_bound(reversed);
+		if (k <= 0) {
+			Integer s = carl::pow(Integer(2), std::size_t(-k));
+			taylor_shift(node.poly, s);
+			node.b += node.a * s;
+			node.d += node.c * s;
+			node.zero_root = carl::is_zero(node.poly.front());
+			if (node.zero_root) {
+				res.emplace_back(Number(node.b) / Number(node.d));
+				node.poly.erase(node.poly.begin());
+			}
+			variations = count_sign_variations(node.poly, 2);
+			if (variations == 0) continue;
+			if (isolated(node, variations)) {
+				add_interval(node);
+				continue;
+			}
+		}
+		// Split into the roots above one, q(x+1), and below one, (x+1)^n * q(1/(x+1)).
+		Node right{node.poly, node.a, node.a + node.b, node.c, node.c + node.d, false, node.infinity_root};
+		taylor_shift_one(right.poly);
+		Node left{std::move(node.poly), node.b, node.a + node.b, node.d, node.c + node.d, false, node.zero_root};
+		std::reverse(left.poly.begin(), left.poly.end());
+		taylor_shift_one(left.poly);
+		if (carl::is_zero(right.poly.front())) {
+			res.emplace_back(Number(right.b) / Number(right.d));
+			right.poly.erase(right.poly.begin());
+			left.poly.erase(left.poly.begin());
+			right.zero_root = true;
+			left.zero_root = true;
+		}
+		stack.push_back(std::move(right));
+		stack.push_back(std::move(left));
+	}
+	return res;
+}
+
+/**
+ * Isolates the positive roots of p with the given strategy.
+ * @param p Square-free polynomial with integer coefficients and p(0) != 0.
+ * @param strategy Either RootIsolationStrategy::Descartes or RootIsolationStrategy::ContinuedFraction.
+ * @return Open isolating intervals and point intervals for rational roots, unordered.
+ */
+template<typename Number, typename Integer>
+std::vector<Interval<Number>> isolate_positive_roots(std::vector<Integer> p, RootIsolationStrategy strategy) {
+	if (strategy == RootIsolationStrategy::ContinuedFraction) {
+		return isolate_positive_roots_vas<Number>(std::move(p));
+	}
+	assert(strategy == RootIsolationStrategy::Descartes);
+	return isolate_positive_roots_vca<Number>(std::move(p));
+}
+
+}
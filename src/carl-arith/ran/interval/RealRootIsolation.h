@@ -2,12 +2,14 @@
 
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
 #include "ran_interval.h"
+#include "DescartesIsolation.h"
 
 #include <carl-arith/interval/set_theory.h>
 #include <carl-arith/interval/sampling.h>
 #include <carl-arith/poly/umvpoly/functions/Factorization_univariate.h>
 #include <carl-arith/poly/umvpoly/functions/SignVariations.h>
 #include <carl-common/util/streamingOperators.h>
+#include <carl-arith/poly/umvpoly/functions/AberthEhrlich.h>
 #include <carl-arith/poly/umvpoly/functions/EigenWrapper.h>
 #include <carl-arith/poly/umvpoly/functions/Evaluation.h>
 #include <carl-arith/poly/umvpoly/functions/RootElimination.h>
@@ -21,6 +23,8 @@ using carl::operator<<;
  * 
  * After some rather easy preprocessing (make polynomial square-free, eliminate zero roots, solve low-degree polynomial trivially, use root bounds to shrink the interval) 
  * we employ bisection which can optionally be initialized by approximations.
+ * Alternatively, the roots are isolated on integer coefficients using Descartes' rule of signs
+ * or by certified numerical approximation, see RootIsolationStrategy.
  */
 template<typename Number>
 class RealRootIsolation {
@@ -35,21 +39,8 @@ class RealRootIsolation {
 	std::vector<RealAlgebraicNumberInterval<Number>> mRoots;
 	/// The bounding interval.
 	Interval<Number> mInterval;
-	/// The sturm sequence for mPolynomial.
-	// std::optional<std::vector<UnivariatePolynomial<Number>>> mSturmSequence;
-
-	/// Return the sturm sequence for mPolynomial, create it if necessary.
-	// const auto& sturm_sequence() {
-	// 	if (!mSturmSequence) {
-	// 		mSturmSequence = carl::sturm_sequence(mPolynomial);
-	// 	}
-	// 	return *mSturmSequence;
-	// }
-	/// Reset the sturm sequence, used if the polynomial was modified.
-	// void reset_sturm_sequence() {
-	// 	mSturmSequence.reset();
-	// }
-
+	/// The isolation algorithm used after preprocessing.
+	RootIsolationStrategy mStrategy;
 	/// Handle zero roots (p(0) == 0)
 	void eliminate_zero_roots() {
 		if (mPolynomial.zero_is_root()) {
@@ -133,7 +124,6 @@ class RealRootIsolation {
 	void add_root(const Number& n) {
 		CARL_LOG_TRACE("carl.ran.realroots", "Add root " << n);
 		assert(carl::is_root_of(mPolynomial, n));
-		// reset_sturm_sequence();
 		eliminate_root(mPolynomial, n);
 		mRoots.emplace_back(n);
 	}
@@ -265,6 +255,112 @@ class RealRootIsolation {
 		}
 	}
 
+	/// Primitive integer coefficients of a positive multiple of mPolynomial.
+	auto integer_coefficients() const {
+		using Integer = typename IntegralType<Number>::type;
+		Integer den(1);
+		for (const auto& c: mPolynomial.coefficients()) {
+			den = carl::lcm(den, carl::get_denom(c));
+		}
+		std::vector<Integer> res;
+		Integer content(0);
+		for (const auto& c: mPolynomial.coefficients()) {
+			res.emplace_back(carl::get_num(c * Number(den)));
+			content = carl::gcd(content, res.back());
+		}
+		for (auto& c: res) {
+			c = carl::div(c, content);
+		}
+		return res;
+	}
+
+	/**
+	 * Add a root given by an isolating interval of mPolynomial or by a point interval, if it lies within mInterval.
+	 * Isolating intervals that overlap the bounds of mInterval are cut at these bounds.
+	 */
+	void add_root_within_bounds(Interval<Number> i) {
+		if (i.is_point_interval()) {
+			if (mInterval.contains(i.lower())) {
+				add_root(i.lower());
+			}
+			return;
+		}
+		if (i.upper() <= mInterval.lower() || i.lower() >= mInterval.upper()) {
+			return;
+		}
+		if (i.contains(mInterval.lower())) {
+			auto sgn = carl::sgn(carl::evaluate(mPolynomial, mInterval.lower()));
+			if (sgn == Sign::ZERO) {
+				if (mInterval.contains(mInterval.lower())) add_root(mInterval.lower());
+				return;
+			}
+			if (sgn != carl::sgn(carl::evaluate(mPolynomial, i.lower()))) {
+				return;
+			}
+			i.set_lower(mInterval.lower());
+		}
+		if (i.contains(mInterval.upper())) {
+			auto sgn = carl::sgn(carl::evaluate(mPolynomial, mInterval.upper()));
+			if (sgn == Sign::ZERO) {
+				if (mInterval.contains(mInterval.upper())) add_root(mInterval.upper());
+				return;
+			}
+			if (sgn != carl::sgn(carl::evaluate(mPolynomial, i.upper()))) {
+				return;
+			}
+			i.set_upper(mInterval.upper());
+		}
+		add_root(i);
+	}
+
+	/// Isolate positive roots of p(x) and p(-x) on integer coefficients.
+	void isolate_by_descartes() {
+		if (mInterval.is_empty()) {
+			return;
+		}
+		auto positive = integer_coefficients();
+		auto negative = positive;
+		for (std::size_t i = 1; i < negative.size(); i += 2) {
+			negative[i] = -negative[i];
+		}
+		CARL_LOG_DEBUG("carl.ran.realroots", "Isolating roots of " << positive << " and " << negative);
+		std::vector<Interval<Number>> intervals;
+		if (mInterval.upper() > 0) {
+			intervals = descartes::isolate_positive_roots<Number>(std::move(positive), mStrategy);
+		}
+		if (mInterval.lower() < 0) {
+			for (const auto& i: descartes::isolate_positive_roots<Number>(std::move(negative), mStrategy)) {
+				intervals.emplace_back(-i);
+			}
+		}
+		CARL_LOG_DEBUG("carl.ran.realroots", "Isolating intervals: " << intervals);
+		for (const auto& i: intervals) {
+			add_root_within_bounds(i);
+		}
+	}
+
+	/**
+	 * Isolate roots by certified approximations of all complex roots.
+	 * If the approximations can not be certified, we fall back to bisection.
+	 */
+	void isolate_by_approximation() {
+		if constexpr (std::is_same<Number, mpq_class>::value) {
+			if (mInterval.is_empty()) {
+				return;
+			}
+			auto intervals = carl::roots::aberth::isolate_real_roots(integer_coefficients());
+			if (intervals) {
+				CARL_LOG_DEBUG("carl.ran.realroots", "Certified isolating intervals: " << *intervals);
+				for (const auto& i: *intervals) {
+					add_root_within_bounds(i);
+				}
+				return;
+			}
+			CARL_LOG_DEBUG("carl.ran.realroots", "Certification failed, falling back to bisection");
+		}
+		isolate_by_bisection();
+	}
+
 	/// Do actual root isolation.
 	void compute_roots() {
 		// Handle zero polynomial
@@ -288,12 +384,21 @@ class RealRootIsolation {
 			}
 		}
 
-		// Now do actual bisection
-		isolate_by_bisection();
+		// Now do actual isolation
+		switch (mStrategy) {
+			case RootIsolationStrategy::Bisection:
+				isolate_by_bisection();
+				break;
+			case RootIsolationStrategy::Approximation:
+				isolate_by_approximation();
+				break;
+			default:
+				isolate_by_descartes();
+		}
 	}
 
 public:
-	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval): mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval) {
+	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval, RootIsolationStrategy strategy = RootIsolationStrategy::Bisection): mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval), mStrategy(strategy) {
 		CARL_LOG_DEBUG("carl.ran.realroots", "Reduced " << polynomial << " to " << mPolynomial);
 	}
 
@@ -307,7 +412,6 @@ public:
 				CARL_LOG_DEBUG("carl.ran.realroots", "Coputing root of factor " << factor);
 				mPolynomial = factor.first;
 				mInterval = interval;
-				// reset_sturm_sequence();
 				compute_roots();
 			}
 		} else {
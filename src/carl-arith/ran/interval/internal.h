@@ -4,50 +4,83 @@
 #include "AlgebraicSubstitution.h"
 
 namespace carl::ran::interval {
+    /**
+     * Defining polynomials of a sequence of real algebraic numbers within their tower of field extensions.
+     * The tower only depends on the assignment, hence it can be used to substitute the assignment into many polynomials.
+     */
+    template<typename Number>
+    struct ExtensionTower {
+        std::vector<MultivariatePolynomial<Number>> polys;
+        std::vector<Variable> variables;
+    };
+
+    /**
+     * Builds the tower of field extensions for the given assignment using FieldExtensions.
+     */
+    template<typename Number>
+    ExtensionTower<Number> build_extension_tower(const OrderedAssignment<RealAlgebraicNumberInterval<Number>>& m) {
+        ExtensionTower<Number> tower;
+        FieldExtensions<Number, MultivariatePolynomial<Number>> fe;
+        for (const auto& vic: m) {
+            tower.variables.emplace_back(vic.first);
+            auto res = fe.extend(vic.first, vic.second);
+            if (res.first) {
+                tower.polys.emplace_back(vic.first - res.second);
+            } else {
+                tower.polys.emplace_back(res.second);
+            }
+            CARL_LOG_TRACE("carl.ran", vic.first << " -> " << vic.second << " is now " << tower.polys.back());
+        }
+        return tower;
+    }
+
+    /**
+     * Substitutes the assignment represented by the tower into p.
+     */
+    template<typename Number, typename Coeff>
+    std::optional<UnivariatePolynomial<Number>> substitute_tower_into_polynomial(
+            const UnivariatePolynomial<Coeff>& p,
+            const ExtensionTower<Number>& tower
+    ) {
+        std::vector<MultivariatePolynomial<Number>> polys(tower.polys);
+        std::vector<Variable> varOrder(tower.variables);
+        polys.emplace_back(p);
+        varOrder.emplace_back(p.main_var());
+        CARL_LOG_TRACE("carl.ran", "Perform algebraic substitution on " << polys << " wrt " << varOrder);
+        return algebraic_substitution(polys, varOrder);
+    }
+
     template<typename Number, typename Coeff>
     std::optional<UnivariatePolynomial<Number>> substitute_rans_into_polynomial(
             const UnivariatePolynomial<Coeff>& p,
             const OrderedAssignment<RealAlgebraicNumberInterval<Number>>& m,
             bool use_lazard = false // TODO revert
     ) {
+        if (!use_lazard) {
+            CARL_LOG_TRACE("carl.ran", "Substituting using field extensions only");
+            return substitute_tower_into_polynomial(p, build_extension_tower(m));
+        }
+
         std::vector<MultivariatePolynomial<Number>> polys;
         std::vector<Variable> varOrder;
 
-        if (use_lazard) {
-            CARL_LOG_TRACE("carl.ran", "Substituting using Lazard evaluation");
-            auto le = LazardEvaluation<Number, MultivariatePolynomial<Number>>(MultivariatePolynomial<Number>(p));
-            for (const auto& vic: m) {
-                varOrder.emplace_back(vic.first);
-                auto res = le.substitute(vic.first, vic.second, true);
-                if (res.first) {
-                    polys.emplace_back(vic.first - res.second);
-                } else {
-                    polys.emplace_back(res.second);
-                }
-                CARL_LOG_TRACE("carl.ran", vic.first << " -> " << vic.second << " is now " << polys.back());
-            }
-            polys.emplace_back(le.getLiftingPoly());
-            varOrder.emplace_back(p.main_var());
-            CARL_LOG_TRACE("carl.ran", "main poly " << p << " in " << p.main_var() << " is now " << polys.back());
-        } else {
-            CARL_LOG_TRACE("carl.ran", "Substituting using field extensions only");
-            FieldExtensions<Number, MultivariatePolynomial<Number>> fe;
-            for (const auto& vic: m) {
-                varOrder.emplace_back(vic.first);
-                auto res = fe.extend(vic.first, vic.second);
-                if (res.first) {
-                    polys.emplace_back(vic.first - res.second);
-                } else {
-                    polys.emplace_back(res.second);
-                }
-                CARL_LOG_TRACE("carl.ran", vic.first << " -> " << vic.second << " is now " << polys.back());
+        CARL_LOG_TRACE("carl.ran", "Substituting using Lazard evaluation");
+        auto le = LazardEvaluation<Number, MultivariatePolynomial<Number>>(MultivariatePolynomial<Number>(p));
+        for (const auto& vic: m) {
+            varOrder.emplace_back(vic.first);
+            auto res = le.substitute(vic.first, vic.second, true);
+            if (res.first) {
+                polys.emplace_back(vic.first - res.second);
+            } else {
+                polys.emplace_back(res.second);
             }
-            polys.emplace_back(p);
-            varOrder.emplace_back(p.main_var());
-            CARL_LOG_TRACE("carl.ran", "main poly " << p << " in " << p.main_var() << " is now " << polys.back());
+            CARL_LOG_TRACE("carl.ran", vic.first << " -> " << vic.second << " is now " << polys.back());
         }
+        polys.emplace_back(le.getLiftingPoly());
+        varOrder.emplace_back(p.main_var());
+        CARL_LOG_TRACE("carl.ran", "main poly " << p << " in " << p.main_var() << " is now " << polys.back());
 
         CARL_LOG_TRACE("carl.ran", "Perform algebraic substitution on " << polys << " wrt " << varOrder);
         return algebraic_substitution(polys, varOrder);
     }
-}
\ No newline at end of file
+}
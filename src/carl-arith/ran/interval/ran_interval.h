@@ -15,6 +15,7 @@
 
 #include "../ran_operations.h"
 #include "../ran_operations_number.h"
+#include "ran_interval_filter.h"
 
 #include <list>
 #include <boost/logic/tribool.hpp>
@@ -69,6 +70,10 @@ private:
 		Interval<Number> interval;
 		/// Sign of polynomial at interval.lower()
 		Sign lower_sign;
+		/// Floating-point enclosure, created on demand by compare().
+		std::optional<ran::interval::Enclosure> enclosure;
+		/// Quadratic interval refinement splits the interval into 2^qir_exponent parts.
+		std::size_t qir_exponent = 2;
 
 		content(const Interval<Number>& i)
 			: polynomial(std::nullopt), interval(i), lower_sign(Sign::ZERO) {}
@@ -149,6 +154,124 @@ private:
 		}
 	}
 
+	/// Returns the floating-point enclosure, which is created and tightened on demand.
+	const ran::interval::Enclosure& enclosure(bool tightened) const {
+		auto& e = m_content->enclosure;
+		if (is_numeric()) {
+			if (!e || !e->is_tightened()) e.emplace(value());
+			return *e;
+		}
+		if (!e) {
+			e.emplace(interval_int());
+		}
+		if (tightened && !e->is_tightened()) {
+			CARL_CALL_STATISTICS(++ran::interval::filter_statistics().refinements);
+			// The interval may have been refined since the enclosure was created.
+			e.emplace(interval_int());
+			e->tighten(polynomial_int(), interval_int(), m_content->lower_sign);
+		}
+		return *e;
+	}
+
+	/**
+	 * Tries to determine the sign of this - rhs by floating-point enclosures.
+	 * The enclosures are tightened only if the initial ones overlap.
+	 */
+	template<typename Other>
+	std::optional<Sign> compare_by_enclosure(const Other& rhs) const {
+		auto rhs_enclosure = [&rhs](bool tightened) {
+			if constexpr (std::is_same_v<Other, RealAlgebraicNumberInterval>) return rhs.enclosure(tightened);
+			else return ran::interval::Enclosure(rhs);
+		};
+		if (auto res = compare_enclosures(enclosure(false), rhs_enclosure(false))) {
+			CARL_CALL_STATISTICS(++ran::interval::filter_statistics().hits);
+			return res;
+		}
+		if (auto res = compare_enclosures(enclosure(true), rhs_enclosure(true))) {
+			CARL_CALL_STATISTICS(++ran::interval::filter_statistics().refined_hits);
+			return res;
+		}
+		CARL_CALL_STATISTICS(++ran::interval::filter_statistics().misses);
+		return std::nullopt;
+	}
+
+	/// Sets the interval to the given open interval, whose lower bound has sign lower_sign.
+	void set_open_interval(const Number& lower, const Number& upper) const {
+		interval_int() = Interval<Number>(lower, BoundType::STRICT, upper, BoundType::STRICT);
+		assert(interval_int().is_consistent());
+	}
+
+	/// Sets the number to the given root of the polynomial.
+	void set_point(const Number& root) const {
+		interval_int() = Interval<Number>(root, root);
+		m_content->simplify_to_point();
+	}
+
+	/**
+	 * Performs a single step of quadratic interval refinement.
+	 *
+	 * The interval is divided into N = 2^qir_exponent parts and the part containing the root is guessed from the secant
+	 * through the interval bounds. If two sign evaluations confirm the guess, the interval shrinks by a factor of N
+	 * and N is squared for the next step, hence the number of correct bits doubles in every successful step.
+	 * Otherwise, the interval still shrinks by at least one part and N is reduced to its square root.
+	 * @see @cite Abb06
+	 */
+	void refine_quadratic() const {
+		if (is_numeric()) return;
+		Number lower = interval_int().lower();
+		Number upper = interval_int().upper();
+		Number flower = carl::evaluate(polynomial_int(), lower);
+		Number fupper = carl::evaluate(polynomial_int(), upper);
+		Number parts = carl::pow(Number(2), m_content->qir_exponent);
+		Number width = (upper - lower) / parts;
+		Number k = carl::floor(parts * flower / (flower - fupper) + Number(1) / 2);
+		if (k < 1) k = 1;
+		if (k > parts - 1) k = parts - 1;
+		Number pivot = lower + k * width;
+		auto psgn = carl::sgn(carl::evaluate(polynomial_int(), pivot));
+		if (psgn == Sign::ZERO) {
+			set_point(pivot);
+			return;
+		}
+		bool success = true;
+		if (psgn == m_content->lower_sign) {
+			// The root is above the pivot, check whether it is below the next grid point.
+			if (k + 1 == parts) {
+				set_open_interval(pivot, upper);
+			} else {
+				Number next = pivot + width;
+				auto next_sgn = carl::sgn(carl::evaluate(polynomial_int(), next));
+				if (next_sgn == Sign::ZERO) {
+					set_point(next);
+					return;
+				}
+				success = next_sgn != m_content->lower_sign;
+				if (success) set_open_interval(pivot, next);
+				else set_open_interval(next, upper);
+			}
+		} else {
+			// The root is below the pivot, check whether it is above the previous grid point.
+			if (k == 1) {
+				set_open_interval(lower, pivot);
+			} else {
+				Number prev = pivot - width;
+				auto prev_sgn = carl::sgn(carl::evaluate(polynomial_int(), prev));
+				if (prev_sgn == Sign::ZERO) {
+					set_point(prev);
+					return;
+				}
+				success = prev_sgn == m_content->lower_sign;
+				if (success) set_open_interval(prev, pivot);
+				else set_open_interval(lower, prev);
+			}
+		}
+		if (success) {
+			m_content->qir_exponent *= 2;
+		} else {
+			m_content->qir_exponent = std::max<std::size_t>(2, m_content->qir_exponent / 2);
+		}
+	}
+
 public: // TODO should be private
 	void refine() const {
 		if (is_numeric()) return;
@@ -156,6 +279,18 @@ public: // TODO should be private
 		refine_internal(pivot);
 	}
 
+	/**
+	 * Refines the isolating interval until its width is at most 2^-bits, using quadratic interval refinement.
+	 * @param bits Absolute precision in bits.
+	 */
+	void refine_to_precision(std::size_t bits) const {
+		if (is_numeric()) return;
+		Number width = Number(1) / carl::pow(Number(2), bits);
+		while (!is_numeric() && interval_int().diameter() > width) {
+			refine_quadratic();
+		}
+	}
+
 private:
 	std::optional<Sign> refine_using(const Number& pivot) const {
 		if (interval_int().contains(pivot)) {
@@ -273,8 +408,8 @@ public:
 	Sign sgn(const Polynomial& p) const {
 		Polynomial tmp = replaceVariable(p);
 		if (polynomial_int() == tmp) return Sign::ZERO;
-		auto seq = carl::sturm_sequence(polynomial_int(), derivative(polynomial_int()) * tmp);
-		int variations = carl::count_real_roots(seq, interval_int());
+		auto seq = carl::cached_sturm_sequence(polynomial_int(), derivative(polynomial_int()) * tmp);
+		int variations = carl::count_real_roots(*seq, interval_int());
 		assert((variations == -1) || (variations == 0) || (variations == 1));
 		switch (variations) {
 		case -1:
@@ -383,6 +518,11 @@ bool compare(const RealAlgebraicNumberInterval<Number>& lhs, const RealAlgebraic
 	}
 
 	if (carl::set_have_intersection(lhs.interval_int(), rhs.interval_int())) {
+		// Disjoint intervals are decided below without tightening any enclosure.
+		if (auto res = lhs.compare_by_enclosure(rhs)) {
+			CARL_LOG_TRACE("carl.ran", "Decided by floating-point enclosures");
+			return evaluate(*res, relation);
+		}
 		CARL_LOG_TRACE("carl.ran", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " do intersect");
 		auto intersection = carl::set_intersection(lhs.interval_int(), rhs.interval_int());
 		assert(!intersection.is_empty());
@@ -419,8 +559,18 @@ bool compare(const RealAlgebraicNumberInterval<Number>& lhs, const RealAlgebraic
 			if (relation == Relation::NEQ) return true;
 			CARL_LOG_TRACE("carl.ran", "Refine until intervals become disjoint");
 			while (lhs.interval_int() == rhs.interval_int()) {
-				lhs.refine();
-				rhs.refine();
+				lhs.refine_quadratic();
+				rhs.refine_quadratic();
+				// The refined intervals may overlap, make them equal or disjoint again.
+				if (carl::set_have_intersection(lhs.interval_int(), rhs.interval_int())) {
+					auto intersection = carl::set_intersection(lhs.interval_int(), rhs.interval_int());
+					lhs.refine_using(intersection.lower());
+					rhs.refine_using(intersection.lower());
+					if (!intersection.is_point_interval()) {
+						lhs.refine_using(intersection.upper());
+						rhs.refine_using(intersection.upper());
+					}
+				}
 			}
 		}
 	}
@@ -440,6 +590,13 @@ bool compare(const RealAlgebraicNumberInterval<Number>& lhs, const RealAlgebraic
 
 template<typename Number>
 bool compare(const RealAlgebraicNumberInterval<Number>& lhs, const Number& rhs, const Relation relation) {
+	// Avoid evaluating the polynomial at rhs, if possible.
+	if (!lhs.is_numeric() && lhs.interval_int().contains(rhs)) {
+		if (auto res = lhs.compare_by_enclosure(rhs)) {
+			CARL_LOG_TRACE("carl.ran", "Decided by floating-point enclosures");
+			return evaluate(*res, relation);
+		}
+	}
 	auto res = lhs.refine_using(rhs);
 	if (res) {
 		return evaluate(*res, relation);
@@ -33,10 +33,7 @@ std::optional<RealAlgebraicNumberInterval<Number>> evaluate(MultivariatePolynomi
 		if (!p.has(var)) continue;
 		if (refine_model) {
 			CARL_LOG_TRACE("carl.ran.evaluation", "Refine " << var << " = " << ran);
-			static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
-			while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-				ran.refine();
-			}
+			ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 		}
 		if (ran.is_numeric()) {
 			CARL_LOG_TRACE("carl.ran.evaluation", "Substitute " << var << " = " << ran);
@@ -105,17 +102,20 @@ std::optional<RealAlgebraicNumberInterval<Number>> evaluate(MultivariatePolynomi
 	CARL_LOG_TRACE("carl.ran.evaluation", "-> " << interval);
 
 	CARL_LOG_TRACE("carl.ran.evaluation", "Compute sturm sequence");
-	auto sturm_seq = sturm_sequence(*res);
+	auto sturm_seq = cached_sturm_sequence(*res);
 	// the interval should include at least one root.
 	CARL_LOG_TRACE("carl.ran.evaluation", "Refine intervals");
 	assert(!carl::is_zero(*res));
-	assert(carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(sturm_seq, interval) >= 1);
-	while (!interval.is_point_interval() && (carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(sturm_seq, interval) != 1)) {
+	assert(carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(*sturm_seq, interval) >= 1);
+	// the precision of the assignment is doubled in every step
+	std::size_t precision = 20;
+	while (!interval.is_point_interval() && (carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(*sturm_seq, interval) != 1)) {
 		CARL_LOG_TRACE("carl.ran.evaluation", "Refinement step");
 		// refine the result interval until it isolates exactly one real root of the result polynomial
+		precision *= 2;
 		for (const auto& [var, ran] : m) {
 			if (var_to_interval.find(var) == var_to_interval.end()) continue;
-			ran.refine();
+			ran.refine_to_precision(precision);
 			if (ran.is_numeric()) {
 				substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
 				for (const auto& entry : m) {
@@ -153,10 +153,7 @@ boost::tribool evaluate(const BasicConstraint<MultivariatePolynomial<Number>>& c
 		for (const auto& [var, ran] : m) {
 			if (!p.has(var)) continue;
 			if (refine_model) {
-				static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
-				while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-					ran.refine();
-				}
+				ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 			}
 			if (ran.is_numeric()) {
 				substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
@@ -268,10 +265,13 @@ boost::tribool evaluate(const BasicConstraint<MultivariatePolynomial<Number>>& c
 
 		// refine the interval until it is either positive or negative or is contained in (neg_ub,pos_lb)
 		CARL_LOG_DEBUG("carl.ran.evaluation", "Refine until interval is in (" << neg_ub << "," << pos_lb << ") or interval is positive or negative");
+		// the precision of the assignment is doubled in every step
+		std::size_t precision = 20;
 		while (!((neg_ub < interval.lower() || neg_ub == 0) && (interval.upper() < pos_lb || pos_lb == 0))) {
+			precision *= 2;
 			for (const auto& [var, ran] : m) {
 				if (var_to_interval.find(var) == var_to_interval.end()) continue;
-				ran.refine();
+				ran.refine_to_precision(precision);
 				if (ran.is_numeric()) {
 					substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
 					for (const auto& entry : m) {
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "ran_interval.h"
+#include "ran_interval_evaluation.h"
+#include "AlgebraicSubstitution.h"
+
+#include <carl-arith/constraint/BasicConstraint.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/evaluate.h>
+#include <carl-arith/poly/umvpoly/functions/RootBounds.h>
+
+#include <boost/logic/tribool.hpp>
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * Evaluates polynomials and constraints under a fixed assignment of real algebraic numbers and caches the results.
+ *
+ * Signs are cached per polynomial, normalized to coprime coefficients such that positive multiples share their entry.
+ * As the context owns the assignment, a cached sign stays valid until one of the variables of the polynomial is reassigned.
+ * Hence, the assignment can be extended incrementally, e.g. when lifting a sample point, without losing the results for
+ * polynomials that do not contain the new variable.
+ * Besides the signs, the defining polynomials of the assigned numbers and the results of the algebraic substitutions are cached.
+ * Refinements of the assigned numbers are shared with the assignment that was passed in, as usual for real algebraic numbers.
+ */
+template<typename Number>
+class EvaluationContext {
+public:
+	using RAN = RealAlgebraicNumberInterval<Number>;
+	using Polynomial = MultivariatePolynomial<Number>;
+private:
+	Assignment<RAN> m_assignment;
+	/// Defining polynomials of the assigned irrational numbers, in the variable they are assigned to.
+	std::map<Variable, UnivariatePolynomial<Polynomial>> m_defining_polynomials;
+	/// Signs of polynomials with coprime coefficients.
+	std::unordered_map<Polynomial, Sign> m_signs;
+	/// Results of the algebraic substitutions, i.e. univariate polynomials that vanish at the value of the key.
+	std::unordered_map<Polynomial, std::optional<UnivariatePolynomial<Number>>> m_substitutions;
+	std::size_t m_hits = 0;
+	std::size_t m_misses = 0;
+
+	/// Removes all cached results that depend on the value of v.
+	void invalidate(Variable v) {
+		m_defining_polynomials.erase(v);
+		for (auto it = m_signs.begin(); it != m_signs.end();) {
+			if (it->first.has(v)) it = m_signs.erase(it);
+			else ++it;
+		}
+		for (auto it = m_substitutions.begin(); it != m_substitutions.end();) {
+			if (it->first.has(v)) it = m_substitutions.erase(it);
+			else ++it;
+		}
+	}
+
+	const UnivariatePolynomial<Polynomial>& defining_polynomial(Variable v) {
+		auto it = m_defining_polynomials.find(v);
+		if (it == m_defining_polynomials.end()) {
+			const auto& ran = m_assignment.at(v);
+			it = m_defining_polynomials.emplace(v, replace_main_variable(ran.polynomial(), v).template convert<Polynomial>()).first;
+		}
+		return it->second;
+	}
+
+	/// Computes a nonzero univariate polynomial that vanishes at the value of p, which contains only irrational numbers.
+	const std::optional<UnivariatePolynomial<Number>>& substitution(const Polynomial& p, const std::map<Variable, Interval<Number>>& var_to_interval) {
+		auto it = m_substitutions.find(p);
+		if (it != m_substitutions.end()) return it->second;
+		Variable v = fresh_real_variable();
+		std::vector<UnivariatePolynomial<Polynomial>> algebraic_information;
+		for (const auto& entry: var_to_interval) {
+			algebraic_information.emplace_back(defining_polynomial(entry.first));
+		}
+		// substitute RANs with low degrees first
+		std::sort(algebraic_information.begin(), algebraic_information.end(), [](const auto& a, const auto& b){
+			return a.degree() > b.degree();
+		});
+		auto res = algebraic_substitution(UnivariatePolynomial<Polynomial>(v, {Polynomial(-p), Polynomial(1)}), algebraic_information);
+		return m_substitutions.emplace(p, std::move(res)).first->second;
+	}
+
+	static std::optional<Sign> sign_of(const Interval<Number>& i) {
+		if (i.is_positive()) return Sign::POSITIVE;
+		if (i.is_negative()) return Sign::NEGATIVE;
+		if (i.is_zero()) return Sign::ZERO;
+		return std::nullopt;
+	}
+
+	/**
+	 * Computes the sign of p, which has coprime coefficients, by interval evaluation and root bounds on the algebraic substitution.
+	 * This is the same method as carl::evaluate() for constraints, but it determines the sign instead of the truth of a single relation.
+	 */
+	std::optional<Sign> compute_sign(Polynomial p) {
+		for (const auto& v: carl::variables(p)) {
+			const auto& ran = m_assignment.at(v);
+			ran.refine_to_precision(20); // 1/2^20, taken from libpoly
+			if (ran.is_numeric()) {
+				substitute_inplace(p, v, Polynomial(ran.value()));
+			}
+		}
+		if (p.is_number()) return carl::sgn(p.constant_part());
+
+		std::map<Variable, Interval<Number>> var_to_interval;
+		for (const auto& v: carl::variables(p)) {
+			var_to_interval.emplace(v, m_assignment.at(v).interval());
+		}
+		Interval<Number> interval = carl::evaluate(p, var_to_interval);
+		if (auto s = sign_of(interval); s) return s;
+
+		if (var_to_interval.size() == 1) {
+			return m_assignment.at(var_to_interval.begin()->first).sgn(carl::to_univariate_polynomial(p));
+		}
+
+		const auto& res = substitution(p, var_to_interval);
+		if (!res) return std::nullopt;
+		assert(!carl::is_zero(*res));
+		// If the value of p is within (neg_ub,pos_lb), it must be zero.
+		auto pos_lb = lagrangePositiveLowerBound(*res);
+		auto neg_ub = lagrangeNegativeUpperBound(*res);
+		if (pos_lb == 0 && neg_ub == 0) return Sign::ZERO;
+
+		// the precision of the assignment is doubled in every step
+		std::size_t precision = 20;
+		while (!((neg_ub < interval.lower() || neg_ub == 0) && (interval.upper() < pos_lb || pos_lb == 0))) {
+			precision *= 2;
+			for (auto it = var_to_interval.begin(); it != var_to_interval.end();) {
+				const auto& ran = m_assignment.at(it->first);
+				ran.refine_to_precision(precision);
+				if (ran.is_numeric()) {
+					substitute_inplace(p, it->first, Polynomial(ran.value()));
+					it = var_to_interval.erase(it);
+				} else {
+					it->second = ran.interval();
+					++it;
+				}
+			}
+			interval = carl::evaluate(p, var_to_interval);
+			if (auto s = sign_of(interval); s) return s;
+		}
+		return Sign::ZERO;
+	}
+
+public:
+	EvaluationContext() = default;
+	explicit EvaluationContext(const Assignment<RAN>& assignment): m_assignment(assignment) {}
+
+	const Assignment<RAN>& assignment() const {
+		return m_assignment;
+	}
+
+	/// Assigns r to v. All cached results that depend on a previous value of v are removed.
+	void assign(Variable v, const RAN& r) {
+		if (m_assignment.find(v) != m_assignment.end()) {
+			invalidate(v);
+		}
+		m_assignment.insert_or_assign(v, r);
+	}
+
+	/// Removes the assignment of v and all cached results that depend on it.
+	void unassign(Variable v) {
+		if (m_assignment.erase(v) > 0) {
+			invalidate(v);
+		}
+	}
+
+	/// Number of queries that were answered from the cache.
+	std::size_t hits() const {
+		return m_hits;
+	}
+	/// Number of queries that needed a computation.
+	std::size_t misses() const {
+		return m_misses;
+	}
+
+	/**
+	 * Determines the sign of p under the assignment.
+	 * @return The sign, or nothing if p contains unassigned variables or the algebraic substitution failed.
+	 */
+	std::optional<Sign> sgn(const Polynomial& p) {
+		if (p.is_number()) return carl::sgn(p.constant_part());
+		for (const auto& v: carl::variables(p)) {
+			if (m_assignment.find(v) == m_assignment.end()) return std::nullopt;
+		}
+		Polynomial key = p.coprime_coefficients_sign_preserving();
+		auto it = m_signs.find(key);
+		if (it != m_signs.end()) {
+			++m_hits;
+			return it->second;
+		}
+		++m_misses;
+		auto res = compute_sign(key);
+		if (res) m_signs.emplace(std::move(key), *res);
+		return res;
+	}
+
+	/**
+	 * Evaluates the constraint under the assignment.
+	 * @return The truth value, or indeterminate if the sign of the left hand side can not be determined.
+	 */
+	boost::tribool evaluate(const BasicConstraint<Polynomial>& c) {
+		auto s = sgn(c.lhs());
+		if (!s) return boost::indeterminate;
+		return carl::evaluate(*s, c.relation());
+	}
+};
+
+}
@@ -118,11 +118,11 @@ public:
 			return RealAlgebraicNumberInterval<Number>(interval.lower());
 		}
 
-		auto sturm_seq = sturm_sequence(res);
+		auto sturm_seq = cached_sturm_sequence(res);
 		// the interval should include at least one root.
 		assert(!carl::is_zero(res));
-		assert(carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || count_real_roots(sturm_seq, interval) >= 1);
-		while (!interval.is_point_interval() && (carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || count_real_roots(sturm_seq, interval) != 1)) {
+		assert(carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || count_real_roots(*sturm_seq, interval) >= 1);
+		while (!interval.is_point_interval() && (carl::is_root_of(res, interval.lower()) || carl::is_root_of(res, interval.upper()) || count_real_roots(*sturm_seq, interval) != 1)) {
 			// refine the result interval until it isolates exactly one real root of the result polynomial
 			for (const auto& [var, ran] : m_ir_assignments) {
 				if (var_to_interval.find(var) == var_to_interval.end()) continue;
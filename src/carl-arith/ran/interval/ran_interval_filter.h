@@ -0,0 +1,129 @@
+#pragma once
+
+#include "ran_interval_filter_statistics.h"
+
+#include <carl-arith/core/Sign.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/numbers/numbers.h>
+#include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * A floating-point enclosure of a real number, used to decide comparisons of real algebraic numbers without exact arithmetic.
+ *
+ * All operations are done in double precision with the default rounding mode, every result is widened by one ulp.
+ * As the rounding error is at most half an ulp, the bounds are rigorous without switching the rounding mode.
+ * An enclosure is either derived from an isolating interval or tightened by floating-point bisection,
+ * where the sign of the polynomial at the midpoint is evaluated in interval arithmetic.
+ */
+class Enclosure {
+	/// Maximum number of bisection steps when tightening.
+	static constexpr std::size_t max_tighten_steps = 128;
+
+	double mLower;
+	double mUpper;
+	/// Whether the enclosure can not be improved by tighten().
+	bool mTightened;
+
+	static double down(double d) {
+		return std::nextafter(d, -std::numeric_limits<double>::infinity());
+	}
+	static double up(double d) {
+		return std::nextafter(d, std::numeric_limits<double>::infinity());
+	}
+
+	/**
+	 * Evaluates the polynomial given by enclosures of its coefficients at x using Horner's scheme.
+	 * @return The sign, if it is certified.
+	 */
+	static std::optional<Sign> sign_at(const std::vector<std::pair<double,double>>& coeffs, double x) {
+		double lower = coeffs.back().first;
+		double upper = coeffs.back().second;
+		for (std::size_t i = coeffs.size() - 1; i > 0; --i) {
+			double l = lower * x;
+			double u = upper * x;
+			if (x < 0) std::swap(l, u);
+			lower = down(down(l) + coeffs[i - 1].first);
+			upper = up(up(u) + coeffs[i - 1].second);
+		}
+		if (lower > 0) return Sign::POSITIVE;
+		if (upper < 0) return Sign::NEGATIVE;
+		return std::nullopt;
+	}
+public:
+	/// Encloses a rational number, this can not be tightened.
+	template<typename Number>
+	explicit Enclosure(const Number& n) {
+		double d = carl::to_double(n);
+		mLower = down(d);
+		mUpper = up(d);
+		mTightened = true;
+	}
+	/// Encloses the interval.
+	template<typename Number>
+	explicit Enclosure(const Interval<Number>& i) {
+		mLower = down(carl::to_double(i.lower()));
+		mUpper = up(carl::to_double(i.upper()));
+		mTightened = false;
+	}
+
+	double lower() const {
+		return mLower;
+	}
+	double upper() const {
+		return mUpper;
+	}
+	bool is_tightened() const {
+		return mTightened;
+	}
+
+	/**
+	 * Tightens the enclosure of the unique root of p within the open interval i, which is contained in this enclosure.
+	 * Stops if the sign at the midpoint can not be certified or the bounds are adjacent floating-point numbers.
+	 * @param p Polynomial.
+	 * @param i Isolating interval.
+	 * @param lower_sign Sign of p at the lower bound of i.
+	 */
+	template<typename Number>
+	void tighten(const UnivariatePolynomial<Number>& p, const Interval<Number>& i, Sign lower_sign) {
+		mTightened = true;
+		std::vector<std::pair<double,double>> coeffs;
+		for (const auto& c: p.coefficients()) {
+			double d = carl::to_double(c);
+			if (!std::isfinite(d)) return;
+			coeffs.emplace_back(down(d), up(d));
+		}
+		for (std::size_t step = 0; step < max_tighten_steps; ++step) {
+			double mid = mLower / 2 + mUpper / 2;
+			if (!(mLower < mid && mid < mUpper)) break;
+			// The sign only tells on which side the root is, if mid is within the isolating interval.
+			if (!i.contains(carl::rationalize<Number>(mid))) break;
+			auto sgn = sign_at(coeffs, mid);
+			if (!sgn) break;
+			if (*sgn == lower_sign) {
+				mLower = mid;
+			} else {
+				mUpper = mid;
+			}
+		}
+	}
+
+	/**
+	 * Compares two enclosures.
+	 * @return NEGATIVE if lhs is smaller, POSITIVE if lhs is larger, nothing if the enclosures overlap.
+	 */
+	friend std::optional<Sign> compare_enclosures(const Enclosure& lhs, const Enclosure& rhs) {
+		if (lhs.mUpper < rhs.mLower) return Sign::NEGATIVE;
+		if (lhs.mLower > rhs.mUpper) return Sign::POSITIVE;
+		return std::nullopt;
+	}
+};
+
+}
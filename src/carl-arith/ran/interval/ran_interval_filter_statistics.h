@@ -0,0 +1,39 @@
+#pragma once
+
+#include <carl-statistics/carl-statistics.h>
+
+#ifdef CARL_DEVOPTION_Statistics
+
+#include <atomic>
+
+namespace carl {
+namespace ran::interval {
+
+class FilterStatistics : public statistics::Statistics {
+public:
+	/// Comparisons decided by the enclosures of the interval bounds.
+	std::atomic<std::size_t> hits = 0;
+	/// Comparisons decided after tightening the enclosures.
+	std::atomic<std::size_t> refined_hits = 0;
+	/// Comparisons that needed exact arithmetic.
+	std::atomic<std::size_t> misses = 0;
+	/// Number of tightened enclosures.
+	std::atomic<std::size_t> refinements = 0;
+	void collect() {
+		std::size_t total = hits + refined_hits + misses;
+		Statistics::addKeyValuePair("hits", hits.load());
+		Statistics::addKeyValuePair("refined_hits", refined_hits.load());
+		Statistics::addKeyValuePair("misses", misses.load());
+		Statistics::addKeyValuePair("hit_rate", total == 0 ? 0.0 : static_cast<double>(hits + refined_hits) / static_cast<double>(total));
+		Statistics::addKeyValuePair("refinements", refinements.load());
+	}
+};
+
+static auto& filter_statistics() {
+	static CARL_INIT_STATISTICS(FilterStatistics, stats, "ran_interval_filter");
+	return stats;
+}
+
+}
+}
+#endif
@@ -6,28 +6,36 @@
 #include <carl-logging/carl-logging.h>
 #include <carl-arith/core/Sign.h>
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Derivative.h>
+#include <carl-common/config.h>
 
 #include "RealRootIsolation.h"
 
 
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <map>
+#include <thread>
+#include <vector>
 
 namespace carl::ran::interval {
 
 /**
  * Find all real roots of a univariate 'polynomial' with numeric coefficients within a given 'interval'.
- * The roots are sorted in ascending order.
+ * The roots are isolated using the given 'strategy' and sorted in ascending order.
  */
 template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, EnableIf<std::is_same<Coeff, Number>> = dummy>
 RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
 		const UnivariatePolynomial<Coeff>& polynomial,
-		const Interval<Number>& interval = Interval<Number>::unbounded_interval()
+		const Interval<Number>& interval = Interval<Number>::unbounded_interval(),
+		RootIsolationStrategy strategy = RootIsolationStrategy::Bisection
 ) {
 	if (carl::is_zero(polynomial)) {
 		return RealRootsResult<RealAlgebraicNumberInterval<Number>>::nullified_response();
 	}
 	CARL_LOG_DEBUG("carl.ran.realroots", polynomial << " within " << interval);
-	carl::ran::interval::RealRootIsolation rri(polynomial, interval);
+	carl::ran::interval::RealRootIsolation rri(polynomial, interval, strategy);
 	auto r = rri.get_roots();
 	CARL_LOG_DEBUG("carl.ran.realroots", "-> " << r);
 	return RealRootsResult<RealAlgebraicNumberInterval<Number>>::roots_response(std::move(r));
@@ -41,32 +49,27 @@ RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
 template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, DisableIf<std::is_same<Coeff, Number>> = dummy>
 RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
 		const UnivariatePolynomial<Coeff>& polynomial,
-		const Interval<Number>& interval = Interval<Number>::unbounded_interval()
+		const Interval<Number>& interval = Interval<Number>::unbounded_interval(),
+		RootIsolationStrategy strategy = RootIsolationStrategy::Bisection
 ) {
 	assert(polynomial.is_univariate());
-	return real_roots_interval(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constant_part(); })), interval);
+	return real_roots_interval(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constant_part(); })), interval, strategy);
 }
 
+namespace detail_real_roots {
+
 /**
- * Replace all variables except one of the multivariate polynomial 'p' by
- * numbers as given in the mapping 'm', which creates a univariate polynomial,
- * and return all roots of that created polynomial.
- * Note that 'p' is represented as a univariate polynomial with polynomial coefficients.
- * Its main variable is not replaced and stays the main variable of the created polynomial.
- * However, all variables in the polynomial coefficients are replaced, which is why
- * <ul>
- *   <li>the main variable of 'p' must not be in 'm'</li>
- *   <li>all variables from the coefficients of 'p' must be in 'm'</li>
- * </ul>
- * The roots are sorted in ascending order.
- * Returns a RealRootsResult indicating whether the roots could be isolated or the polynomial
- * was not univariate or is nullified.  
+ * Implements real_roots_interval() for an assignment.
+ * The tower of field extensions for the irrational part of the assignment is obtained from 'tower',
+ * which allows to share it between several polynomials.
  */
-template<typename Coeff, typename Number>
-RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
+template<typename Coeff, typename Number, typename TowerProvider>
+RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_with_tower(
 		const UnivariatePolynomial<Coeff>& poly,
 		const Assignment<RealAlgebraicNumberInterval<Number>>& varToRANMap,
-		const Interval<Number>& interval = Interval<Number>::unbounded_interval()
+		const Interval<Number>& interval,
+		RootIsolationStrategy strategy,
+		TowerProvider&& tower
 ) {
 	CARL_LOG_FUNC("carl.ran.realroots", poly << " in " << poly.main_var() << ", " << varToRANMap << ", " << interval);
 	assert(varToRANMap.count(poly.main_var()) == 0);
@@ -104,19 +107,12 @@ RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
 	if (ir_map.empty()) {
 		assert(polyCopy.is_univariate());
 		CARL_LOG_TRACE("carl.ran.realroots", "poly " << polyCopy << " is univariate after substituting rational assignments");
-		return real_roots_interval(polyCopy, interval);
+		return real_roots_interval(polyCopy, interval, strategy);
 	} else {
 		CARL_LOG_TRACE("carl.ran.realroots", polyCopy << " in " << polyCopy.main_var() << ", " << varToRANMap << ", " << interval);
 		assert(ir_map.find(polyCopy.main_var()) == ir_map.end());
 
-		// substitute RANs with low degrees first
-		OrderedAssignment<RealAlgebraicNumberInterval<Number>> ord_ass;
-		for (const auto& ass : ir_map) ord_ass.emplace_back(ass);
-		std::sort(ord_ass.begin(), ord_ass.end(), [](const auto& a, const auto& b){ 
-			return a.second.polynomial().degree() > b.second.polynomial().degree();
-		});
-
-		std::optional<UnivariatePolynomial<Number>> evaledpoly = substitute_rans_into_polynomial(polyCopy, ord_ass);
+		std::optional<UnivariatePolynomial<Number>> evaledpoly = substitute_tower_into_polynomial(polyCopy, tower(ir_map));
 		if (!evaledpoly) {
 			CARL_LOG_TRACE("carl.ran.realroots", "poly still contains unassigned variable -> non-univariate");
 			return RealRootsResult<RealAlgebraicNumberInterval<Number>>::non_univariate_response();
@@ -129,7 +125,7 @@ RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
 		CARL_LOG_TRACE("carl.ran.realroots", "Calling on " << *evaledpoly);
 		BasicConstraint<MultivariatePolynomial<Number>> cons(MultivariatePolynomial<Number>(polyCopy), Relation::EQ);
 		std::vector<RealAlgebraicNumberInterval<Number>> roots;
-		auto res = real_roots_interval(*evaledpoly, interval);
+		auto res = real_roots_interval(*evaledpoly, interval, strategy);
 		for (const auto& r: res.roots()) { // TODO can be made more efficient!
 			CARL_LOG_TRACE("carl.ran.realroots", "Checking " << polyCopy.main_var() << " = " << r);
 			ir_map[polyCopy.main_var()] = r;
@@ -144,4 +140,203 @@ RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
 	}
 }
 
-}
\ No newline at end of file
+}
+
+/**
+ * Replace all variables except one of the multivariate polynomial 'p' by
+ * numbers as given in the mapping 'm', which creates a univariate polynomial,
+ * and return all roots of that created polynomial.
+ * Note that 'p' is represented as a univariate polynomial with polynomial coefficients.
+ * Its main variable is not replaced and stays the main variable of the created polynomial.
+ * However, all variables in the polynomial coefficients are replaced, which is why
+ * <ul>
+ *   <li>the main variable of 'p' must not be in 'm'</li>
+ *   <li>all variables from the coefficients of 'p' must be in 'm'</li>
+ * </ul>
+ * The roots are sorted in ascending order.
+ * Returns a RealRootsResult indicating whether the roots could be isolated or the polynomial
+ * was not univariate or is nullified.  
+ */
+template<typename Coeff, typename Number>
+RealRootsResult<RealAlgebraicNumberInterval<Number>> real_roots_interval(
+		const UnivariatePolynomial<Coeff>& poly,
+		const Assignment<RealAlgebraicNumberInterval<Number>>& varToRANMap,
+		const Interval<Number>& interval = Interval<Number>::unbounded_interval(),
+		RootIsolationStrategy strategy = RootIsolationStrategy::Bisection
+) {
+	return detail_real_roots::real_roots_with_tower(poly, varToRANMap, interval, strategy, [](const auto& ir_map) {
+		// substitute RANs with low degrees first
+		OrderedAssignment<RealAlgebraicNumberInterval<Number>> ord_ass;
+		for (const auto& ass : ir_map) ord_ass.emplace_back(ass);
+		std::sort(ord_ass.begin(), ord_ass.end(), [](const auto& a, const auto& b){ 
+			return a.second.polynomial().degree() > b.second.polynomial().degree();
+		});
+		return build_extension_tower(ord_ass);
+	});
+}
+
+/**
+ * A root of a set of polynomials as computed by real_roots_interval() on a batch of polynomials.
+ */
+template<typename Number>
+struct BatchRealRoot {
+	RealAlgebraicNumberInterval<Number> value;
+	/// Pairs of the index of a polynomial vanishing at this root and the multiplicity of the root, ordered by the index.
+	std::vector<std::pair<std::size_t,std::size_t>> sources;
+};
+
+/**
+ * The result of real_roots_interval() on a batch of polynomials.
+ */
+template<typename Number>
+struct BatchRealRootsResult {
+	/// Distinct roots of all polynomials in ascending order.
+	std::vector<BatchRealRoot<Number>> roots;
+	/// Indices of the polynomials that vanish under the assignment.
+	std::vector<std::size_t> nullified;
+	/// Indices of the polynomials that contain unassigned variables.
+	std::vector<std::size_t> non_univariate;
+};
+
+namespace detail_real_roots {
+
+/**
+ * Computes the multiplicity of the root of p, i.e. the number of derivatives with respect to v that vanish under m.
+ * Assumes that v is assigned to a root of p in m.
+ */
+template<typename Number>
+std::size_t root_multiplicity(const MultivariatePolynomial<Number>& p, Variable v, const Assignment<RealAlgebraicNumberInterval<Number>>& m) {
+	std::size_t res = 1;
+	auto d = carl::derivative(p, v);
+	while (!carl::is_zero(d) && evaluate(BasicConstraint<MultivariatePolynomial<Number>>(d, Relation::EQ), m)) {
+		++res;
+		d = carl::derivative(d, v);
+	}
+	return res;
+}
+
+/**
+ * Creates a copy of the assignment that does not share the refinement state with the original assignment.
+ */
+template<typename Number>
+Assignment<RealAlgebraicNumberInterval<Number>> independent_copy(const Assignment<RealAlgebraicNumberInterval<Number>>& m) {
+	Assignment<RealAlgebraicNumberInterval<Number>> res;
+	for (const auto& [var, ran]: m) {
+		if (ran.is_numeric()) {
+			res.emplace(var, RealAlgebraicNumberInterval<Number>(ran.value()));
+		} else {
+			res.emplace(var, RealAlgebraicNumberInterval<Number>(ran.polynomial(), ran.interval()));
+		}
+	}
+	return res;
+}
+
+}
+
+/**
+ * Find all real roots of a set of polynomials under a common assignment, as it is needed when lifting a sample.
+ * Every polynomial is treated as by real_roots_interval() for a single polynomial, but the tower of field extensions
+ * for the irrational part of the assignment is only constructed once and shared by all polynomials.
+ *
+ * The roots of all polynomials are merged: every root is reported once, together with the indices of all polynomials
+ * vanishing at this root and the respective multiplicities.
+ * All polynomials must have the same main variable, which must not be in the assignment.
+ *
+ * If parallel is set, the polynomials are processed concurrently. Every thread works on its own copy of the assignment,
+ * as evaluation refines the assigned numbers. As the pools are only synchronized if carl is built with THREAD_SAFE,
+ * parallel is ignored otherwise.
+ */
+template<typename Coeff, typename Number>
+BatchRealRootsResult<Number> real_roots_interval(
+		const std::vector<UnivariatePolynomial<Coeff>>& polys,
+		const Assignment<RealAlgebraicNumberInterval<Number>>& varToRANMap,
+		const Interval<Number>& interval = Interval<Number>::unbounded_interval(),
+		RootIsolationStrategy strategy = RootIsolationStrategy::Bisection,
+		bool parallel = false
+) {
+	using RAN = RealAlgebraicNumberInterval<Number>;
+	BatchRealRootsResult<Number> res;
+	if (polys.empty()) return res;
+	Variable main_var = polys.front().main_var();
+	assert(std::all_of(polys.begin(), polys.end(), [main_var](const auto& p){ return p.main_var() == main_var; }));
+	assert(varToRANMap.count(main_var) == 0);
+
+	// substitute RANs with low degrees first
+	OrderedAssignment<RAN> ord_ass;
+	for (const auto& [var, ran]: varToRANMap) {
+		if (ran.is_numeric()) continue;
+		if (std::any_of(polys.begin(), polys.end(), [var = var](const auto& p){ return p.has(var); })) {
+			ord_ass.emplace_back(var, ran);
+		}
+	}
+	std::sort(ord_ass.begin(), ord_ass.end(), [](const auto& a, const auto& b){ 
+		return a.second.polynomial().degree() > b.second.polynomial().degree();
+	});
+	std::optional<ExtensionTower<Number>> tower;
+	auto shared_tower = [&](const auto&) -> const ExtensionTower<Number>& {
+		assert(tower);
+		return *tower;
+	};
+	if (!ord_ass.empty()) {
+		tower = build_extension_tower(ord_ass);
+	}
+
+	std::vector<RealRootsResult<RAN>> results(polys.size(), RealRootsResult<RAN>::no_roots_response());
+	std::vector<std::vector<std::size_t>> multiplicities(polys.size());
+	auto isolate_range = [&](std::size_t begin, std::size_t end, const Assignment<RAN>& ass) {
+		Assignment<RAN> root_ass(ass);
+		for (std::size_t i = begin; i < end; ++i) {
+			results[i] = detail_real_roots::real_roots_with_tower(polys[i], ass, interval, strategy, shared_tower);
+			if (!results[i].is_univariate()) continue;
+			MultivariatePolynomial<Number> p(polys[i]);
+			for (const auto& r: results[i].roots()) {
+				root_ass[main_var] = r;
+				multiplicities[i].emplace_back(detail_real_roots::root_multiplicity(p, main_var, root_ass));
+			}
+		}
+	};
+#ifndef THREAD_SAFE
+	parallel = false;
+#endif
+	std::size_t threads = parallel ? std::min<std::size_t>(std::thread::hardware_concurrency(), polys.size()) : 1;
+	if (threads > 1) {
+		std::vector<Assignment<RAN>> assignments;
+		std::size_t chunk = (polys.size() + threads - 1) / threads;
+		for (std::size_t begin = 0; begin < polys.size(); begin += chunk) {
+			assignments.emplace_back(detail_real_roots::independent_copy(varToRANMap));
+		}
+		std::vector<std::future<void>> tasks;
+		for (std::size_t begin = 0, t = 0; begin < polys.size(); begin += chunk, ++t) {
+			tasks.emplace_back(std::async(std::launch::async, isolate_range, begin, std::min(begin + chunk, polys.size()), std::cref(assignments[t])));
+		}
+		for (auto& t: tasks) t.get();
+	} else {
+		isolate_range(0, polys.size(), varToRANMap);
+	}
+
+	// Merge the roots, equal roots of different polynomials end up next to each other.
+	std::vector<std::pair<RAN, std::pair<std::size_t,std::size_t>>> entries;
+	for (std::size_t i = 0; i < polys.size(); ++i) {
+		if (results[i].is_nullified()) {
+			res.nullified.emplace_back(i);
+		} else if (results[i].is_non_univariate()) {
+			res.non_univariate.emplace_back(i);
+		} else {
+			const auto& roots = results[i].roots();
+			for (std::size_t j = 0; j < roots.size(); ++j) {
+				entries.emplace_back(roots[j], std::make_pair(i, multiplicities[i][j]));
+			}
+		}
+	}
+	std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b){ return a.first < b.first; });
+	for (const auto& [root, source]: entries) {
+		if (res.roots.empty() || !(res.roots.back().value == root)) {
+			res.roots.push_back(BatchRealRoot<Number>{root, {}});
+		}
+		res.roots.back().sources.emplace_back(source);
+	}
+	CARL_LOG_DEBUG("carl.ran.realroots", "Roots of " << polys << " under " << varToRANMap << ": " << res.roots.size() << " distinct roots");
+	return res;
+}
+
+}
@@ -31,6 +31,7 @@
 
 #include "interval/ran_interval.h"
 #include "interval/ran_interval_evaluation.h"
+#include "interval/ran_interval_evaluation_context.h"
 
 //#include "thom/ran_thom.h"
 //#include "thom/ran_thom_evaluation.h"
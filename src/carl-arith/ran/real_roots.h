@@ -17,13 +17,13 @@ namespace carl::ran {
 namespace internal {
 template<typename Poly>
 struct real_roots_internal {
-    static RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const Interval<typename Poly::NumberType>& interval) {
+    static RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const Interval<typename Poly::NumberType>& interval, RootIsolationStrategy) {
         CARL_LOG_FATAL("carl.ran", "real_roots not implemented for type: " << typeid(Poly).name() << " " << polynomial << " " << interval);
         assert(false);
         return RealRootsResult<typename Poly::RootType>::no_roots_response();
     }
 
-    static RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const std::map<Variable, typename Poly::RootType>& assignment, const Interval<typename Poly::Number>& interval) {
+    static RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const std::map<Variable, typename Poly::RootType>& assignment, const Interval<typename Poly::Number>& interval, RootIsolationStrategy) {
         CARL_LOG_FATAL("carl.ran", "real_roots not implemented for type: " << typeid(Poly).name() << " " << polynomial << " " << assignment << " " << interval);
         assert(false);
         return RealRootsResult<typename Poly::RootType>::no_roots_response();
@@ -33,12 +33,12 @@ struct real_roots_internal {
 #ifdef USE_LIBPOLY
 template<>
 struct real_roots_internal<LPPolynomial> {
-    static RealRootsResult<LPPolynomial::RootType> real_roots(const LPPolynomial& polynomial, const Interval<LPPolynomial::NumberType>& interval) {
+    static RealRootsResult<LPPolynomial::RootType> real_roots(const LPPolynomial& polynomial, const Interval<LPPolynomial::NumberType>& interval, RootIsolationStrategy) {
         CARL_LOG_DEBUG("carl.ran", "Called real_roots for LPPolynomial: " << polynomial);
         return carl::ran::libpoly::real_roots_libpoly(polynomial, interval);
     }
 
-    static RealRootsResult<LPPolynomial::RootType> real_roots(const LPPolynomial& polynomial, const std::map<Variable, LPPolynomial::RootType>& assignment, const Interval<LPPolynomial::NumberType>& interval) {
+    static RealRootsResult<LPPolynomial::RootType> real_roots(const LPPolynomial& polynomial, const std::map<Variable, LPPolynomial::RootType>& assignment, const Interval<LPPolynomial::NumberType>& interval, RootIsolationStrategy) {
         CARL_LOG_DEBUG("carl.ran", "Called real_roots for LPPolynomial: " << polynomial << " " << assignment);
         return carl::ran::libpoly::real_roots_libpoly(polynomial, assignment, interval);
     }
@@ -47,26 +47,44 @@ struct real_roots_internal<LPPolynomial> {
 
 template<typename Coeff>
 struct real_roots_internal<UnivariatePolynomial<Coeff>> {
-    static RealRootsResult<typename UnivariatePolynomial<Coeff>::RootType> real_roots(const UnivariatePolynomial<Coeff>& polynomial, const Interval<typename UnivariatePolynomial<Coeff>::NumberType>& interval) {
+    static RealRootsResult<typename UnivariatePolynomial<Coeff>::RootType> real_roots(const UnivariatePolynomial<Coeff>& polynomial, const Interval<typename UnivariatePolynomial<Coeff>::NumberType>& interval, RootIsolationStrategy strategy) {
         CARL_LOG_DEBUG("carl.ran", "Called real_roots for UnivariatePolynomial: " << polynomial);
-        return carl::ran::interval::real_roots_interval(polynomial, interval);
+        return carl::ran::interval::real_roots_interval(polynomial, interval, strategy);
     }
 
-    static RealRootsResult<typename UnivariatePolynomial<Coeff>::RootType> real_roots(const UnivariatePolynomial<Coeff>& polynomial, const std::map<Variable, typename UnivariatePolynomial<Coeff>::RootType>& assignment, const Interval<typename UnivariatePolynomial<Coeff>::NumberType>& interval) {
+    static RealRootsResult<typename UnivariatePolynomial<Coeff>::RootType> real_roots(const UnivariatePolynomial<Coeff>& polynomial, const std::map<Variable, typename UnivariatePolynomial<Coeff>::RootType>& assignment, const Interval<typename UnivariatePolynomial<Coeff>::NumberType>& interval, RootIsolationStrategy strategy) {
         CARL_LOG_DEBUG("carl.ran", "Called real_roots for UnivariatePolynomial: " << polynomial << " " << assignment);
-        return carl::ran::interval::real_roots_interval(polynomial, assignment, interval);
+        return carl::ran::interval::real_roots_interval(polynomial, assignment, interval, strategy);
     }
 };
 } // namespace internal
 
+/**
+ * Find all real roots of the polynomial within the interval, after substituting the assignment.
+ * The strategy selects the isolation algorithm for univariate polynomials, other backends ignore it.
+ */
 template<typename Poly, typename... Coeff>
-RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const std::map<Variable, typename Poly::RootType>& assignment, const Interval<typename Poly::NumberType>& interval = Interval<typename Poly::NumberType>::unbounded_interval()) {
-    return internal::real_roots_internal<Poly>::real_roots(polynomial, assignment, interval);
+RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const std::map<Variable, typename Poly::RootType>& assignment, const Interval<typename Poly::NumberType>& interval = Interval<typename Poly::NumberType>::unbounded_interval(), RootIsolationStrategy strategy = RootIsolationStrategy::Bisection) {
+    return internal::real_roots_internal<Poly>::real_roots(polynomial, assignment, interval, strategy);
 }
 
+/**
+ * Find all real roots of the polynomial within the interval.
+ * The strategy selects the isolation algorithm for univariate polynomials, other backends ignore it.
+ */
 template<typename Poly, typename... Coeff>
-RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const Interval<typename Poly::NumberType>& interval = Interval<typename Poly::NumberType>::unbounded_interval()) {
-    return internal::real_roots_internal<Poly>::real_roots(polynomial, interval);
+RealRootsResult<typename Poly::RootType> real_roots(const Poly& polynomial, const Interval<typename Poly::NumberType>& interval = Interval<typename Poly::NumberType>::unbounded_interval(), RootIsolationStrategy strategy = RootIsolationStrategy::Bisection) {
+    return internal::real_roots_internal<Poly>::real_roots(polynomial, interval, strategy);
+}
+
+/**
+ * Find all real roots of the polynomials within the interval, after substituting the common assignment.
+ * The roots are merged and sorted, see carl::ran::interval::BatchRealRootsResult.
+ * If parallel is set and carl is built with THREAD_SAFE, the polynomials are processed concurrently.
+ */
+template<typename Coeff>
+auto real_roots(const std::vector<UnivariatePolynomial<Coeff>>& polynomials, const std::map<Variable, typename UnivariatePolynomial<Coeff>::RootType>& assignment, const Interval<typename UnivariatePolynomial<Coeff>::NumberType>& interval = Interval<typename UnivariatePolynomial<Coeff>::NumberType>::unbounded_interval(), RootIsolationStrategy strategy = RootIsolationStrategy::Bisection, bool parallel = false) {
+    return carl::ran::interval::real_roots_interval(polynomials, assignment, interval, strategy, parallel);
 }
 } // namespace carl::ran
 
@@ -6,6 +6,20 @@
 
 namespace carl::ran {
 
+/**
+ * Algorithms to isolate the real roots of a univariate polynomial with numeric coefficients.
+ */
+enum class RootIsolationStrategy {
+    /// Bisection using sign variations, initialized by numerical approximations.
+    Bisection,
+    /// Bisection using Descartes' rule of signs on integer coefficients (Vincent-Collins-Akritas).
+    Descartes,
+    /// Continued fractions using Descartes' rule of signs on integer coefficients (Vincent-Akritas-Strzebonski).
+    ContinuedFraction,
+    /// Certified multiprecision approximation of all roots (Aberth-Ehrlich), falling back to Bisection if certification fails.
+    Approximation
+};
+
 template<typename RAN /*, typename = std::enable_if_t<is_ran_type<RAN>::value> */>
 class RealRootsResult {
 
@@ -328,11 +328,10 @@ private:
 		// (2)
 		products = this->computeProducts(p, currAda);
 		
-		Eigen::VectorXf dprime(long(products.size()));
-		long index = 0;
-		for (const auto& prod : products) {
-			dprime(index) = float(mTaQ(prod));
-			index++;
+		std::vector<TaQResType> queries = mTaQ(products.begin(), products.end());
+		Eigen::VectorXf dprime(long(queries.size()));
+		for (long index = 0; index < long(queries.size()); index++) {
+			dprime(index) = float(queries[std::size_t(index)]);
 		}
 		
 		Eigen::MatrixXf M_prime = kroneckerProduct(currM, mMatrix);
@@ -76,6 +76,12 @@ private:
 	// the groebner base object is used to compute reductions
 	GroebnerBase<Number> mGb;
 	
+	// mTraces[i] is the trace of the multiplication with base_i
+	std::vector<Number> mTraces;
+	
+	// mProductTraces[i][j] is the trace of the multiplication with base_i * base_j
+	std::vector<std::vector<Number>> mProductTraces;
+	
 public:
 	
 	MultiplicationTable() : mTable(), mBase(), mGb() {}
@@ -139,11 +145,23 @@ public:
 	Number trace(const BaseRepresentation<Number>& f) const {
 		Number res(0);
 		for(const auto& index_coeff : f) {
-			for(uint i = 0; i < mBase.size(); i++) {
-				Monomial prod = mBase[index_coeff.first] * mBase[i];
-				BaseRepresentation<Number> prod_br = this->getEntry(prod).br;
-				res += index_coeff.second * prod_br.get(i);
-			}		   
+			res += index_coeff.second * mTraces[index_coeff.first];
+		}
+		return res;
+	}
+	
+	/*
+	 * returns the traces of the multiplications with f * base_j for all j.
+	 * as the trace is linear, the trace of f * g is then the scalar product of g with this vector,
+	 * which avoids multiplying f with every entry of the table when setting up the matrix of a tarski query.
+	 */
+	std::vector<Number> traceForm(const BaseRepresentation<Number>& f) const {
+		std::vector<Number> res(mBase.size(), Number(0));
+		for(const auto& index_coeff : f) {
+			const auto& traces = mProductTraces[index_coeff.first];
+			for(uint j = 0; j < mBase.size(); j++) {
+				res[j] += index_coeff.second * traces[j];
+			}
 		}
 		return res;
 	}
@@ -292,6 +310,23 @@ private:
 				mTable[m] = {baseRepr, pairs};
 			}
 		}
+		
+		// ---- step 4 ---- (not explicitly mentioned)
+		// precompute the traces, they only depend on the table and are needed for every tarski query
+		mTraces.assign(mBase.size(), Number(0));
+		for(uint i = 0; i < mBase.size(); i++) {
+			for(uint k = 0; k < mBase.size(); k++) {
+				mTraces[i] += getEntry(mBase[i] * mBase[k]).br.get(k);
+			}
+		}
+		mProductTraces.assign(mBase.size(), std::vector<Number>(mBase.size(), Number(0)));
+		for(uint i = 0; i < mBase.size(); i++) {
+			for(uint j = i; j < mBase.size(); j++) {
+				Number t = this->trace(getEntry(mBase[i] * mBase[j]).br);
+				mProductTraces[i][j] = t;
+				mProductTraces[j][i] = t;
+			}
+		}
 	}
 };
 
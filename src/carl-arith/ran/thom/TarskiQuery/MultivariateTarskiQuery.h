@@ -23,9 +23,13 @@ int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const Multi
         CoeffMatrix<Number> m(base.size(), base.size());
         CARL_LOG_INFO("carl.thom.tarski", "base size is " << base.size());
         CARL_LOG_INFO("carl.thom.tarski", "setting up the matrix now ...");
+        // the entry for base_i * base_j is trace(q * base_i * base_j), which is linear in the base representation of base_i * base_j
+        std::vector<Number> traces = table.traceForm(q);
         for(const auto& entry : table) {
-                BaseRepresentation<Number> Qc = table.multiply(q, entry.second.br);
-                Number t = table.trace(Qc);
+                Number t(0);
+                for(const auto& index_coeff : entry.second.br) {
+                        t += index_coeff.second * traces[index_coeff.first];
+                }
                 for (const auto& pair : entry.second.pairs) {
                         m(long(pair.first), long(pair.second)) = t;
                 }
@@ -0,0 +1,149 @@
+/*
+ * File:   TarskiQueryCache.h
+ */
+
+#pragma once
+
+#include "MultiplicationTable.h"
+
+#include <carl-arith/poly/umvpoly/functions/Derivative.h>
+#include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
+#include <carl-common/datastructures/LRUMap.h>
+#include <carl-common/datastructures/MemoizingCache.h>
+#include <carl-common/util/hash.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace carl {
+
+/*
+ * Everything needed to compute tarski queries on a fixed zero set.
+ * If the zero set is given by a single univariate polynomial z, this is z and its derivative.
+ * Otherwise, it is the multiplication table of the factor ring modulo the groebner base of the zero set.
+ * The results of the queries are stored as well, as they only depend on the zero set.
+ */
+template<typename Number>
+struct TarskiQueryZeroSet {
+        using Polynomial = MultivariatePolynomial<Number>;
+
+        UnivariatePolynomial<Number> z = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+        UnivariatePolynomial<Number> der = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+        MultiplicationTable<Number> table;
+        bool trivialGb = false;
+
+        // query results for normalized polynomials, guarded by mutex
+        std::mutex mutex;
+        LRUMap<Polynomial, int> results;
+
+        template<typename InputIt>
+        TarskiQueryZeroSet(InputIt first, InputIt last, std::size_t resultCapacity) : results(resultCapacity) {
+                // univariate zero set
+                if(std::distance(first, last) == 1 && first->is_univariate()) {
+                        CARL_LOG_TRACE("carl.thom.tarski.manager", "as a UNIVARIATE manager");
+                        z = carl::to_univariate_polynomial(*first);
+                        CARL_LOG_ASSERT("carl.thom.tarski.manager", !carl::is_zero(z), "");
+                        der = derivative(z);
+                }
+                // multivariate zero set
+                else {
+                        CARL_LOG_TRACE("carl.thom.tarski.manager", "as a MULTIVARIATE manager");
+                        GroebnerBase<Number> gb(first, last);
+                        if(gb.isTrivialBase()) {
+                                trivialGb = true;
+                        }
+                        else {
+                                CARL_LOG_ASSERT("carl.thom.tarski.manager", gb.hasFiniteMon(), "");
+                                if(!gb.hasFiniteMon()) {
+                                        std::cout << "aborting because it was tried to set up a tarki query manager on a non zero-dimensional zero set" << std::endl;
+                                        std::exit(23);
+                                }
+                                table = MultiplicationTable<Number>(gb);
+                        }
+                }
+        }
+
+        bool isUnivariate() const {
+                return !carl::is_zero(z);
+        }
+};
+
+/*
+ * A bounded cache of zero sets for the tarski query managers, keyed by the polynomials defining the zero set.
+ * Thom encodings of the same polynomial, and all comparisons and operations on them, set up sign determinations
+ * on the same zero sets over and over again. With the cache, the groebner base and multiplication table of a zero set
+ * are computed once, and all tarski query managers on this zero set share them together with the query results.
+ * The least recently used zero sets are evicted first. All methods are thread-safe, see MemoizingCache.
+ */
+template<typename Number>
+class TarskiQueryCache {
+public:
+        using ZeroSet = TarskiQueryZeroSet<Number>;
+
+private:
+        using Polynomial = MultivariatePolynomial<Number>;
+        using Key = std::vector<Polynomial>;
+
+        struct KeyHash {
+                std::size_t operator()(const Key& key) const {
+                        return carl::hash_all(key);
+                }
+        };
+
+        MemoizingCache<Key, ZeroSet, KeyHash> mZeroSets;
+        std::size_t mResultCapacity;
+
+public:
+        /*
+         * capacity is the maximal number of zero sets, resultCapacity the maximal number of query results per zero set.
+         */
+        explicit TarskiQueryCache(std::size_t capacity = 256, std::size_t resultCapacity = 10000) :
+                mZeroSets(capacity), mResultCapacity(resultCapacity)
+        {}
+
+        /*
+         * the cache that is used by all tarski query managers
+         */
+        static TarskiQueryCache& getInstance() {
+                static TarskiQueryCache instance;
+                return instance;
+        }
+
+        /*
+         * returns the zero set of the given polynomials.
+         * the zero set does not depend on the order of the polynomials or on constant factors, hence they are normalized and sorted.
+         */
+        template<typename InputIt>
+        std::shared_ptr<ZeroSet> get(InputIt first, InputIt last) {
+                Key key;
+                for(; first != last; first++) key.push_back(first->normalize());
+                std::sort(key.begin(), key.end());
+                key.erase(std::unique(key.begin(), key.end()), key.end());
+                // the setup is done without holding the lock
+                return mZeroSets.get(key, [&]() {
+                        return std::make_shared<ZeroSet>(key.begin(), key.end(), mResultCapacity);
+                });
+        }
+
+        void setCapacity(std::size_t capacity) {
+                mZeroSets.set_capacity(capacity);
+        }
+
+        void clear() {
+                mZeroSets.clear();
+        }
+
+        std::size_t size() const {
+                return mZeroSets.entries();
+        }
+        std::size_t hits() const {
+                return mZeroSets.hits();
+        }
+        std::size_t misses() const {
+                return mZeroSets.misses();
+        }
+};
+
+} // namespace carl
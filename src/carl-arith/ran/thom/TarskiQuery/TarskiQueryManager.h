@@ -11,15 +11,18 @@
 
 #include "MultiplicationTable.h"
 #include "MultivariateTarskiQuery.h"
+#include "TarskiQueryCache.h"
 #include "UnivariateTarskiQuery.h"
 
+#include <carl-arith/poly/umvpoly/functions/Remainder.h>
 #include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
 
 namespace carl {
         
 /*
  * The Tarski query manager is a class designed to manage the computation of Tarski queries.
- * 
+ * The setup of the zero set and the query results are taken from the global TarskiQueryCache,
+ * hence all managers on the same zero set share them.
  */ 
 template<typename Number>
 class TarskiQueryManager {
@@ -30,47 +33,16 @@ public:
 private:
         using Polynomial = MultivariatePolynomial<Number>;
         
-        // for the univariate case
-        UnivariatePolynomial<Number> mZ = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
-        UnivariatePolynomial<Number> mDer = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
-        
-        // for the multivariate case
-        MultiplicationTable<Number> mTab;
-        bool mTrivialGb = false;
-        
-        mutable std::map<Polynomial, QueryResultType> mCache;
+        std::shared_ptr<TarskiQueryZeroSet<Number>> mZeroSet;
         
 public:
         TarskiQueryManager() = default;
         
         template<typename InputIt>
-        TarskiQueryManager(InputIt first, InputIt last) {
-                CARL_LOG_TRACE("carl.thom.tarski.manager", "setting up a taq manager on " << std::vector<Polynomial>(first, last));
-                // univariate manager
-                if(std::distance(first, last) == 1 && first->is_univariate()) {
-                        CARL_LOG_TRACE("carl.thom.tarski.manager", "as a UNIVARIATE manager");
-                        mZ = carl::to_univariate_polynomial(*first);
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", !carl::is_zero(mZ), "");
-                        mDer = derivative(mZ);
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", this->isUnivariateManager(), "");
-                }
-                // multivariate manager
-                else {
-                        CARL_LOG_TRACE("carl.thom.tarski.manager", "as a MULTIVARIATE manager");
-                        GroebnerBase<Number> gb(first, last);
-                        if(gb.isTrivialBase()) {
-                                mTrivialGb = true;
-                        }
-                        else {
-                                CARL_LOG_ASSERT("carl.thom.tarski.manager", gb.hasFiniteMon(), "");
-                                if(!gb.hasFiniteMon()) {
-                                        std::cout << "aborting because it was tried to set up a tarki query manager on a non zero-dimensional zero set" << std::endl;
-                                        std::exit(23);
-                                }
-                                mTab = MultiplicationTable<Number>(gb);
-                        }
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", !this->isUnivariateManager(), "");
-                }
+        TarskiQueryManager(InputIt first, InputIt last) :
+                mZeroSet(TarskiQueryCache<Number>::getInstance().get(first, last))
+        {
+                CARL_LOG_TRACE("carl.thom.tarski.manager", "set up a taq manager on " << std::vector<Polynomial>(first, last));
         }
         
         QueryResultType operator()(const Polynomial& p) const {
@@ -86,21 +58,17 @@ public:
                 
                 // univariate manager
                 if(this->isUnivariateManager()) {
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", p.is_univariate(), "");
-                        UnivariatePolynomial<Number> pUniv(Variable::NO_VARIABLE);
-                        if(p.is_constant()) pUniv = UnivariatePolynomial<Number>(mZ.main_var(), p.lcoeff());
-                        else pUniv = carl::to_univariate_polynomial(p);
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", pUniv.main_var() == mZ.main_var(),
-                                "cannot compute tarski query of " << p << " on " << mZ);
-                        res = univariateTarskiQuery(pUniv, mZ, mDer);
+                        UnivariatePolynomial<Number> pUniv = this->reduceUnivariate(p);
+                        if(carl::is_zero(pUniv)) res = 0;
+                        else res = univariateTarskiQuery(pUniv, mZeroSet->z, mZeroSet->der);
                 }
                 
                 // multivariate manager
                 else {
-                        if(mTrivialGb) res = 0;
+                        if(mZeroSet->trivialGb) res = 0;
                         else {
                         // todo: check if variables in p are also in the polynomials defining the zero set
-                                res = multivariateTarskiQuery(p, mTab);
+                                res = multivariateTarskiQuery(p, mZeroSet->table);
                         }
                 }
                 cache(p, res);
@@ -112,13 +80,25 @@ public:
                 return (*this)(Polynomial(c));
         }
         
+        /*
+         * computes the tarski queries of all polynomials in the range.
+         * all queries share the multiplication table (or the univariate zero set) and the cached results.
+         */
+        template<typename InputIt>
+        std::vector<QueryResultType> operator()(InputIt first, InputIt last) const {
+                std::vector<QueryResultType> res;
+                for(; first != last; first++) res.push_back((*this)(*first));
+                return res;
+        }
+        
         Polynomial reduceProduct(const Polynomial& a, const Polynomial& b) const {
                 if(this->isUnivariateManager()) {
-                        // todo: implement
-                        return a * b;
+                        UnivariatePolynomial<Number> prod = this->reduceUnivariate(a * b);
+                        if(carl::is_zero(prod)) return Polynomial(Number(0));
+                        return Polynomial(prod);
                 }
                 else {
-                        return mTab.baseReprToPolynomial(mTab.reduce(a * b));
+                        return mZeroSet->table.baseReprToPolynomial(mZeroSet->table.reduce(a * b));
                 }
                 
         }
@@ -128,16 +108,31 @@ public:
 private:
         
         bool isUnivariateManager() const {
-                return !carl::is_zero(mZ);
+                return mZeroSet->isUnivariate();
+        }
+        
+        /*
+         * reduces p modulo the univariate polynomial defining the zero set, which does not change p on the zero set
+         */
+        UnivariatePolynomial<Number> reduceUnivariate(const Polynomial& p) const {
+                const auto& z = mZeroSet->z;
+                if(p.is_constant()) return UnivariatePolynomial<Number>(z.main_var(), p.constant_part());
+                CARL_LOG_ASSERT("carl.thom.tarski.manager", p.is_univariate(), "");
+                UnivariatePolynomial<Number> pUniv = carl::to_univariate_polynomial(p);
+                CARL_LOG_ASSERT("carl.thom.tarski.manager", pUniv.main_var() == z.main_var(),
+                        "cannot compute tarski query of " << p << " on " << z);
+                if(pUniv.degree() < z.degree()) return pUniv;
+                return carl::remainder(pUniv, z);
         }
         
         /*
          * looks for the normalization of p in the cache
          */
         bool getCached(const Polynomial& p, QueryResultType& res) const {
-                auto it = mCache.find(p.normalize());
-                if(it != mCache.end()) {
-						res = int(sgn(p.lcoeff())) * (it->second);
+                std::lock_guard<std::mutex> lock(mZeroSet->mutex);
+                const auto* cached = mZeroSet->results.find(p.normalize());
+                if(cached != nullptr) {
+                        res = int(sgn(p.lcoeff())) * (*cached);
                         return true;
                 }
                 return false;
@@ -147,7 +142,8 @@ private:
          * writes normalized p with correspoding result in cache
          */
         void cache(const Polynomial& p, const QueryResultType res) const {
-                mCache.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
+                std::lock_guard<std::mutex> lock(mZeroSet->mutex);
+                mZeroSet->results.insert(p.normalize(), int(sgn(p.lcoeff())) * res);
         }
         
 }; // class TarskiQueryManager
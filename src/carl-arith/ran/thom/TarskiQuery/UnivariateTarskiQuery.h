@@ -9,6 +9,8 @@
 
 #include <carl-arith/core/Sign.h>
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/SignVariations.h>
+#include <carl-arith/poly/umvpoly/functions/SturmSequence.h>
 
 namespace carl {
 
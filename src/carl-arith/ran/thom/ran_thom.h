@@ -2,6 +2,8 @@
 
 #include "ThomEncoding.h"
 #include "../ran_operations.h"
+#include <carl-arith/constraint/BasicConstraint.h>
+#include <carl-arith/core/Variables.h>
 
 
 #include <memory>
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "SqrtEx.h"
+
+#include <carl-common/config.h>
+#include <carl-common/memory/Pool.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace carl {
+
+/**
+ * The powers of a square root expression (q + r*sqrt(t))/s up to some degree.
+ * The k'th power of the numerator is q_k + r_k*sqrt(t).
+ */
+template<typename Poly>
+struct SqrtExPowers {
+	/// s^k for 0 <= k <= degree().
+	std::vector<Poly> denominator;
+	/// q_k for 1 <= k <= degree(), stored at k-1.
+	std::vector<Poly> constant_part;
+	/// r_k for 1 <= k <= degree(), stored at k-1.
+	std::vector<Poly> factor;
+
+	explicit SqrtExPowers(const SqrtEx<Poly>& sqrt_ex):
+		denominator({constant_one<Poly>::get(), sqrt_ex.denominator()}),
+		constant_part({sqrt_ex.constant_part()}),
+		factor({sqrt_ex.factor()})
+	{}
+
+	std::size_t degree() const {
+		return constant_part.size();
+	}
+
+	/**
+	 * Computes further powers until the given degree is reached.
+	 * (q_k + r_k*sqrt(t)) * (q + r*sqrt(t)) = (q_k*q + r_k*r*t) + (q_k*r + r_k*q)*sqrt(t)
+	 */
+	void extend(const SqrtEx<Poly>& sqrt_ex, std::size_t degree) {
+		while (this->degree() < degree) {
+			Poly q = constant_part.back() * sqrt_ex.constant_part() + factor.back() * sqrt_ex.factor() * sqrt_ex.radicand();
+			Poly r = factor.back() * sqrt_ex.constant_part() + constant_part.back() * sqrt_ex.factor();
+			constant_part.emplace_back(std::move(q));
+			factor.emplace_back(std::move(r));
+			denominator.emplace_back(denominator.back() * sqrt_ex.denominator());
+		}
+	}
+};
+
+template<typename Poly>
+struct CachedSqrtExContent {
+	/// The normalized square root expression.
+	SqrtEx<Poly> m_sqrt_ex;
+	/// The hash of the square root expression.
+	std::size_t m_hash;
+	/// Cache for the powers, only ever replaced by a copy with a higher degree.
+	mutable std::shared_ptr<const SqrtExPowers<Poly>> m_powers;
+	#ifdef THREAD_SAFE
+	/// Mutex for access to the powers.
+	mutable std::mutex m_powers_mutex;
+	#endif
+
+	CachedSqrtExContent(SqrtEx<Poly>&& sqrt_ex) : m_sqrt_ex(std::move(sqrt_ex)), m_hash(m_sqrt_ex.hash()) {}
+	const auto& key() const { return m_sqrt_ex; }
+};
+
+template<typename Poly>
+using SqrtExPool = pool::Pool<CachedSqrtExContent<Poly>>;
+
+/**
+ * A hash-consed square root expression.
+ *
+ * Equal square root expressions share their representation, hence comparison and hashing are constant time.
+ * Additionally, the powers needed to substitute the square root expression into polynomials are computed only once.
+ */
+template<typename Poly>
+class PooledSqrtEx {
+private:
+	pool::PoolElement<CachedSqrtExContent<Poly>> m_element;
+
+public:
+	explicit PooledSqrtEx(const SqrtEx<Poly>& sqrt_ex) : m_element(SqrtEx<Poly>(sqrt_ex)) {}
+
+	explicit PooledSqrtEx(SqrtEx<Poly>&& sqrt_ex) : m_element(std::move(sqrt_ex)) {}
+
+	PooledSqrtEx(const PooledSqrtEx& sqrt_ex) : m_element(sqrt_ex.m_element) {}
+
+	PooledSqrtEx(PooledSqrtEx&& sqrt_ex) noexcept : m_element(std::move(sqrt_ex.m_element)) {}
+
+	PooledSqrtEx& operator=(const PooledSqrtEx& sqrt_ex) {
+		m_element = sqrt_ex.m_element;
+		return *this;
+	}
+
+	PooledSqrtEx& operator=(PooledSqrtEx&& sqrt_ex) noexcept {
+		m_element = std::move(sqrt_ex.m_element);
+		return *this;
+	}
+
+	operator const SqrtEx<Poly>& () const {
+		return m_element->m_sqrt_ex;
+	}
+
+	/**
+	 * @return The associated square root expression.
+	 */
+	const SqrtEx<Poly>& sqrt_ex() const {
+		return m_element->m_sqrt_ex;
+	}
+
+	/**
+	 * @return The unique id of this square root expression.
+	 */
+	std::size_t id() const {
+		return m_element.id();
+	}
+
+	/**
+	 * @return A hash value for this square root expression.
+	 */
+	std::size_t hash() const {
+		return m_element->m_hash;
+	}
+
+	/**
+	 * @param degree The maximal degree needed.
+	 * @return The powers of this square root expression, at least up to the given degree.
+	 */
+	std::shared_ptr<const SqrtExPowers<Poly>> powers(std::size_t degree) const {
+		#ifdef THREAD_SAFE
+		std::lock_guard<std::mutex> lock(m_element->m_powers_mutex);
+		#endif
+		auto& powers = m_element->m_powers;
+		if (!powers || powers->degree() < degree) {
+			auto res = powers ? std::make_shared<SqrtExPowers<Poly>>(*powers) : std::make_shared<SqrtExPowers<Poly>>(sqrt_ex());
+			res->extend(sqrt_ex(), degree);
+			powers = std::move(res);
+		}
+		return powers;
+	}
+};
+
+template<typename Poly>
+bool operator==(const PooledSqrtEx<Poly>& lhs, const PooledSqrtEx<Poly>& rhs) {
+	return lhs.id() == rhs.id();
+}
+template<typename Poly>
+bool operator!=(const PooledSqrtEx<Poly>& lhs, const PooledSqrtEx<Poly>& rhs) {
+	return lhs.id() != rhs.id();
+}
+template<typename Poly>
+bool operator<(const PooledSqrtEx<Poly>& lhs, const PooledSqrtEx<Poly>& rhs) {
+	return lhs.id() < rhs.id();
+}
+
+template<typename Poly>
+std::ostream& operator<<(std::ostream& os, const PooledSqrtEx<Poly>& sqrt_ex) {
+	return os << sqrt_ex.sqrt_ex();
+}
+
+template<typename Poly>
+void variables(const PooledSqrtEx<Poly>& ex, carlVariables& vars) {
+	variables(ex.sqrt_ex(), vars);
+}
+
+}
+
+namespace std {
+/**
+ * Implements std::hash for pooled square root expressions.
+ */
+template<typename Poly>
+struct hash<carl::PooledSqrtEx<Poly>> {
+	std::size_t operator()(const carl::PooledSqrtEx<Poly>& sqrt_ex) const {
+		return sqrt_ex.hash();
+	}
+};
+}
@@ -11,6 +11,7 @@
 
 #include <carl-arith/core/Variable.h>
 #include <carl-arith/numbers/numbers.h>
+#include <carl-common/util/hash.h>
 
 #include <cassert>
 #include <iostream>
@@ -187,6 +188,14 @@ namespace carl
              *          false, otherwise.
              */
             bool operator==( const SqrtEx& _toCompareWith ) const;
+
+            /**
+             * @return A hash value for this square root expression.
+             */
+            std::size_t hash() const
+            {
+                return carl::hash_all( m_constant_part, m_factor, m_denominator, m_radicand );
+            }
             
             /**
              * @param _sqrtEx A square root expression, which gets the new content of this square root expression.
@@ -272,7 +281,7 @@ namespace std
          */
         std::size_t operator()( const carl::SqrtEx<Poly>& _sqrtEx ) const 
         {
-            return ((hash<Poly>()(_sqrtEx.radicand()) ^ hash<Poly>()(_sqrtEx.denominator())) ^ hash<Poly>()(_sqrtEx.factor())) ^ hash<Poly>()(_sqrtEx.constant_part());
+            return _sqrtEx.hash();
         }
     };
 } // namespace std
@@ -44,12 +44,7 @@ namespace carl
     void SqrtEx<Poly>::normalize()
     {
 //        std::cout << *this << std::endl;
-        Poly gcdA;
-        if( is_zero(m_factor) )
-        {
-            gcdA = m_constant_part;
-        }
-        else 
+        if( !is_zero(m_factor) )
         {
             Poly sqrtOfRadicand;
             if( m_radicand.sqrt( sqrtOfRadicand ) )
@@ -69,45 +64,34 @@ namespace carl
                     m_radicand *= absOfLCoeff;
                 }
             }
-            if( is_zero(m_factor) )
+        }
+        if( is_zero(m_constant_part) && is_zero(m_factor) ) return;
+        // Only a positive semi-definite common divisor of the numerator and the denominator is cancelled. Such a divisor is not linear,
+        // hence there is nothing to cancel if the denominator is linear. Otherwise the gcd with the denominator is computed first,
+        // as it usually is small, and the factor is only considered if the intermediate gcd is not linear yet.
+        if( !m_denominator.is_linear() )
+        {
+            // The gcd is only determined up to a constant, the rational factors are normalized below.
+            Poly gcdA = m_denominator * m_denominator.coprime_factor();
+            for( const Poly* part : { &m_constant_part, &m_factor } )
             {
-                gcdA = m_constant_part;
+                if( is_zero(*part) || gcdA.is_linear() ) continue;
+                gcdA = carl::gcd( gcdA, Poly( *part * part->coprime_factor() ) );
             }
-            else
+            // Make sure that the polynomial to divide by cannot be negative, otherwise the sign of the square root expression could change.
+            if( !gcdA.is_linear() && carl::definiteness(gcdA) == carl::Definiteness::POSITIVE_SEMI )
             {
-                if( is_zero(m_constant_part) )
+                if( !is_zero(m_constant_part) )
                 {
-                    gcdA = m_factor;
+                    carl::try_divide(m_constant_part, gcdA, m_constant_part );
                 }
-                else
+                if( !is_zero(m_factor) )
                 {
-                    Rational ccConstantPart = m_constant_part.coprime_factor();
-                    Poly cpConstantPart = m_constant_part * ccConstantPart;
-                    Rational ccFactor = m_factor.coprime_factor();
-                    Poly cpFactor = m_factor * ccFactor;
-                    gcdA = carl::gcd( cpConstantPart, cpFactor )*carl::gcd(ccConstantPart,ccFactor);
+                    carl::try_divide(m_factor, gcdA, m_factor );
                 }
+                carl::try_divide(m_denominator, gcdA, m_denominator );
             }
         }
-        if( is_zero(gcdA) ) return;
-        Rational ccGcdA = gcdA.coprime_factor();
-        Poly cpGcdA = gcdA * ccGcdA;
-        Rational ccDenominator = m_denominator.coprime_factor();
-        Poly cpDenominator = m_denominator * ccDenominator;
-        gcdA = carl::gcd( cpGcdA, cpDenominator )*carl::gcd(ccGcdA,ccDenominator);
-        // Make sure that the polynomial to divide by cannot be negative, otherwise the sign of the square root expression could change.
-        if( !(gcdA == constant_one<Poly>::get()) && carl::definiteness(gcdA) == carl::Definiteness::POSITIVE_SEMI )
-        {
-            if( !is_zero(m_constant_part) )
-            {
-				carl::try_divide(m_constant_part, gcdA, m_constant_part );
-            }
-            if( !is_zero(m_factor) )
-            {
-                carl::try_divide(m_factor, gcdA, m_factor );
-            }
-            carl::try_divide(m_denominator, gcdA, m_denominator );
-        }
         Rational numGcd = constant_zero<Rational>::get();
         Rational denomLcm = constant_one<Rational>::get();
         if( is_zero(factor()) )
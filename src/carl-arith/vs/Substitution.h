@@ -1,6 +1,6 @@
 #pragma once
 
-#include "SqrtEx.h"
+#include "PooledSqrtEx.h"
 
 namespace carl {
 
@@ -23,62 +23,38 @@ SqrtEx<Poly> substitute( const SqrtEx<Poly>& sqrt_ex, const std::map<Variable, t
     return SqrtEx( std::move(constantPartEvaluated), std::move(factorEvaluated), std::move(denomEvaluated), std::move(radicandEvaluated) );
 }
 
+namespace detail_substitution {
 /**
- * Substitutes a variable in an expression by a square root expression, which results in a square root expression.
- * @param _substituteIn The polynomial to substitute in.
- * @param _varToSubstitute The variable to substitute.
- * @param _substituteBy The square root expression by which the variable gets substituted.
- * @return The resulting square root expression.
+ * Substitutes a variable in a polynomial by a square root expression, given the coefficients of the polynomial in the variable
+ * and the powers of the square root expression.
+ *
+ * We have to calculate the result of the substitution:
+ *
+ *                           q+r*sqrt{t}
+ *        (a_n*x^n+...+a_0)[------------ / x]
+ *                               s
+ * being:
+ *
+ *      sum_{k=0}^n (a_k * (q+r*sqrt{t})^k * s^{n-k})
+ *      ----------------------------------------------
+ *                           s^n
  */
 template<typename Poly>
-SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToSubstitute, const SqrtEx<Poly>& _substituteBy )
+SqrtEx<Poly> substitute( const SqrtEx<Poly>& _substituteBy, const SqrtExPowers<Poly>& _powers, const VarInfo<Poly>& _varInfo )
 {
-    if( !_substituteIn.has( _varToSubstitute ) )
-        return SqrtEx<Poly>( _substituteIn );
-    /*
-        * We have to calculate the result of the substitution:
-        *
-        *                           q+r*sqrt{t}
-        *        (a_n*x^n+...+a_0)[------------ / x]
-        *                               s
-        * being:
-        *
-        *      sum_{k=0}^n (a_k * (q+r*sqrt{t})^k * s^{n-k})
-        *      ----------------------------------------------
-        *                           s^n
-        */
-    auto varInfo = carl::var_info(_substituteIn, _varToSubstitute, true);
-    const auto& coeffs = varInfo.coeffs();
-    // Calculate the s^k:   (0<=k<=n)
+    const auto& coeffs = _varInfo.coeffs();
     auto coeff = coeffs.begin();
-    carl::uint lastDegree = varInfo.max_degree();
-    std::vector<Poly> sk;
-    sk.push_back(constant_one<Poly>::get());
-    for( carl::uint i = 1; i <= lastDegree; ++i )
-    {
-        // s^i = s^l * s^{i-l}
-        sk.push_back( sk.back() * _substituteBy.denominator() );
-    }
-    // Calculate the constant part and factor of the square root of (q+r*sqrt{t})^k 
-    std::vector<Poly> qk;
-    qk.push_back( _substituteBy.constant_part() );
-    std::vector<Poly> rk;
-    rk.push_back( _substituteBy.factor() );
-    // Let (q+r*sqrt{t})^l be (q'+r'*sqrt{t}) 
-    // then (q+r*sqrt{t})^l+1  =  (q'+r'*sqrt{t}) * (q+r*sqrt{t})  =  ( q'*q+r'*r't  +  (q'*r+r'*q) * sqrt{t} )
-    for( carl::uint i = 1; i < lastDegree; ++i )
-    {
-        // q'*q+r'*r't
-        qk.push_back( qk.back() * _substituteBy.constant_part() + rk.back() * _substituteBy.factor() * _substituteBy.radicand() );
-        // q'*r+r'*q
-        rk.push_back( rk.back() * _substituteBy.constant_part()  + qk.at( i - 1 ) * _substituteBy.factor() );
-    }
+    carl::uint lastDegree = _varInfo.max_degree();
+    assert( _powers.degree() >= lastDegree );
+    const auto& sk = _powers.denominator;
+    const auto& qk = _powers.constant_part;
+    const auto& rk = _powers.factor;
     // Calculate the result:
     Poly resFactor = constant_zero<Poly>::get();
     Poly resConstantPart = constant_zero<Poly>::get();
     if( coeff->first == 0 )
     {
-        resConstantPart += sk.back() * coeff->second;
+        resConstantPart += sk.at( lastDegree ) * coeff->second;
         ++coeff;
     }
     for( ; coeff != coeffs.end(); ++coeff )
@@ -86,7 +62,44 @@ SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToS
         resConstantPart += coeff->second * qk.at( coeff->first - 1 ) * sk.at( lastDegree - coeff->first );
         resFactor       += coeff->second * rk.at( coeff->first - 1 ) * sk.at( lastDegree - coeff->first );
     }
-    return SqrtEx( resConstantPart, resFactor, sk.back(), _substituteBy.radicand() );
+    return SqrtEx<Poly>( std::move(resConstantPart), std::move(resFactor), Poly(sk.at( lastDegree )), Poly(_substituteBy.radicand()) );
+}
 }
 
-}
\ No newline at end of file
+/**
+ * Substitutes a variable in an expression by a square root expression, which results in a square root expression.
+ * @param _substituteIn The polynomial to substitute in.
+ * @param _varToSubstitute The variable to substitute.
+ * @param _substituteBy The square root expression by which the variable gets substituted.
+ * @return The resulting square root expression.
+ */
+template<typename Poly>
+SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToSubstitute, const SqrtEx<Poly>& _substituteBy )
+{
+    if( !_substituteIn.has( _varToSubstitute ) )
+        return SqrtEx<Poly>( _substituteIn );
+    auto varInfo = carl::var_info(_substituteIn, _varToSubstitute, true);
+    SqrtExPowers<Poly> powers( _substituteBy );
+    powers.extend( _substituteBy, varInfo.max_degree() );
+    return detail_substitution::substitute( _substituteBy, powers, varInfo );
+}
+
+/**
+ * Substitutes a variable in an expression by a pooled square root expression, which results in a square root expression.
+ * The powers of the square root expression are shared by all substitutions of the same square root expression.
+ * @param _substituteIn The polynomial to substitute in.
+ * @param _varToSubstitute The variable to substitute.
+ * @param _substituteBy The square root expression by which the variable gets substituted.
+ * @return The resulting square root expression.
+ */
+template<typename Poly>
+SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToSubstitute, const PooledSqrtEx<Poly>& _substituteBy )
+{
+    if( !_substituteIn.has( _varToSubstitute ) )
+        return SqrtEx<Poly>( _substituteIn );
+    auto varInfo = carl::var_info(_substituteIn, _varToSubstitute, true);
+    auto powers = _substituteBy.powers( varInfo.max_degree() );
+    return detail_substitution::substitute( _substituteBy.sqrt_ex(), *powers, varInfo );
+}
+
+}
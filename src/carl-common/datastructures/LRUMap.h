@@ -0,0 +1,94 @@
+/**
+ * @file LRUMap.h
+ */
+
+#pragma once
+
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace carl {
+
+/**
+ * A map of bounded size that evicts the least recently used entry.
+ * It is not synchronized, users that share a map between threads have to lock it themselves.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRUMap {
+	using Entry = std::pair<Key, Value>;
+	std::list<Entry> mEntries;
+	std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> mIndex;
+	std::size_t mCapacity;
+public:
+	explicit LRUMap(std::size_t capacity): mCapacity(capacity) {}
+
+	/**
+	 * Looks up the key and marks the entry as recently used.
+	 * @return Pointer to the value or nullptr.
+	 */
+	const Value* find(const Key& key) {
+		auto it = mIndex.find(key);
+		if (it == mIndex.end()) return nullptr;
+		mEntries.splice(mEntries.begin(), mEntries, it->second);
+		return &it->second->second;
+	}
+
+	/**
+	 * Inserts a new entry, evicting the least recently used entries if the capacity is exceeded.
+	 * @return Number of evicted entries.
+	 */
+	std::size_t insert(const Key& key, const Value& value) {
+		if (mCapacity == 0 || mIndex.find(key) != mIndex.end()) return 0;
+		mEntries.emplace_front(key, value);
+		mIndex.emplace(key, mEntries.begin());
+		return shrink();
+	}
+
+	/**
+	 * Changes the capacity, evicting the least recently used entries if necessary.
+	 * @return Number of evicted entries.
+	 */
+	std::size_t set_capacity(std::size_t capacity) {
+		mCapacity = capacity;
+		return shrink();
+	}
+
+	/**
+	 * Removes the least recently used entry.
+	 * @return The removed value, or nothing if the map is empty.
+	 */
+	std::optional<Value> evict() {
+		if (mEntries.empty()) return std::nullopt;
+		std::optional<Value> res(std::move(mEntries.back().second));
+		mIndex.erase(mEntries.back().first);
+		mEntries.pop_back();
+		return res;
+	}
+
+	std::size_t capacity() const {
+		return mCapacity;
+	}
+
+	std::size_t size() const {
+		return mEntries.size();
+	}
+
+	void clear() {
+		mIndex.clear();
+		mEntries.clear();
+	}
+private:
+	std::size_t shrink() {
+		std::size_t evicted = 0;
+		while (mEntries.size() > mCapacity) {
+			mIndex.erase(mEntries.back().first);
+			mEntries.pop_back();
+			++evicted;
+		}
+		return evicted;
+	}
+};
+
+}
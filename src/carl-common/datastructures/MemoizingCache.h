@@ -0,0 +1,174 @@
+/**
+ * @file MemoizingCache.h
+ */
+
+#pragma once
+
+#include "LRUMap.h"
+
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace carl {
+
+/**
+ * Provides a globally installed instance of T, e.g. a cache that some functions answer from.
+ * T derives from GlobalInstance<T>.
+ */
+template<typename T>
+class GlobalInstance {
+	static std::atomic<T*>& instance() {
+		static std::atomic<T*> instance(nullptr);
+		return instance;
+	}
+public:
+	/**
+	 * @return The installed instance, or nullptr.
+	 */
+	static T* global() {
+		return instance().load(std::memory_order_acquire);
+	}
+	/**
+	 * Installs an instance.
+	 * The caller keeps ownership and has to uninstall the instance before destroying it.
+	 * @param t Instance to use, nullptr uninstalls the current instance.
+	 * @return The previously installed instance.
+	 */
+	static T* set_global(T* t) {
+		return instance().exchange(t, std::memory_order_acq_rel);
+	}
+};
+
+/**
+ * Memoizes the results of some computation, the least recently used results are evicted first.
+ *
+ * Results are stored as shared pointers, hence they are handed out without copying them.
+ * The cache is bounded by the total weight of the results, by default every result weighs one.
+ * All methods are thread-safe. Results are computed without holding the lock, if several threads compute the same
+ * result concurrently, the first stored result is returned to all of them.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class MemoizingCache {
+public:
+	using Pointer = std::shared_ptr<Value>;
+	using Weight = std::function<std::size_t(const Value&)>;
+private:
+	mutable std::mutex mMutex;
+	LRUMap<Key, Pointer, Hash> mValues;
+	Weight mWeight;
+	std::size_t mCapacity;
+	std::size_t mSize = 0;
+	std::size_t mHits = 0;
+	std::size_t mMisses = 0;
+
+	std::size_t weight(const Value& value) const {
+		return mWeight ? mWeight(value) : 1;
+	}
+
+	/// Evicts results until the size fits the capacity. Expects the lock to be held.
+	std::size_t shrink() {
+		std::size_t evicted = 0;
+		while (mSize > mCapacity) {
+			auto value = mValues.evict();
+			assert(value);
+			mSize -= weight(**value);
+			++evicted;
+		}
+		return evicted;
+	}
+public:
+	/**
+	 * @param capacity Maximum total weight of all stored results.
+	 * @param weight Weight of a result, if empty every result weighs one.
+	 */
+	explicit MemoizingCache(std::size_t capacity, Weight weight = Weight()):
+		mValues(std::numeric_limits<std::size_t>::max()), mWeight(std::move(weight)), mCapacity(capacity)
+	{}
+
+	/**
+	 * Looks up the result for the key and counts the query as hit or miss.
+	 * @return The result, or nullptr.
+	 */
+	Pointer find(const Key& key) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (const auto* value = mValues.find(key)) {
+			++mHits;
+			return *value;
+		}
+		++mMisses;
+		return nullptr;
+	}
+
+	/**
+	 * Stores the result for the key. If a result is stored already, value is replaced by the stored result.
+	 * Results that weigh more than the capacity are not stored.
+	 * @return Number of evicted results.
+	 */
+	std::size_t insert(const Key& key, Pointer& value) {
+		std::size_t w = weight(*value);
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (const auto* existing = mValues.find(key)) {
+			value = *existing;
+			return 0;
+		}
+		if (w > mCapacity) return 0;
+		mValues.insert(key, value);
+		mSize += w;
+		return shrink();
+	}
+
+	/**
+	 * Returns the result for the key. If it is not stored, it is obtained from compute() and stored.
+	 * @param compute Callable that returns the result as a Pointer.
+	 */
+	template<typename Compute>
+	Pointer get(const Key& key, Compute&& compute) {
+		if (auto value = find(key)) return value;
+		Pointer value = compute();
+		insert(key, value);
+		return value;
+	}
+
+	/**
+	 * Changes the capacity, evicting results if necessary.
+	 * @return Number of evicted results.
+	 */
+	std::size_t set_capacity(std::size_t capacity) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mCapacity = capacity;
+		return shrink();
+	}
+
+	void clear() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mValues.clear();
+		mSize = 0;
+	}
+
+	/// Number of stored results.
+	std::size_t entries() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mValues.size();
+	}
+	/// Total weight of the stored results.
+	std::size_t size() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mSize;
+	}
+	/// Number of queries answered from the cache.
+	std::size_t hits() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mHits;
+	}
+	/// Number of queries that were not answered from the cache.
+	std::size_t misses() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mMisses;
+	}
+};
+
+}
@@ -0,0 +1,400 @@
+#pragma once
+
+#include <carl-formula/arithmetic/Constraint.h>
+#include <carl-arith/core/Variables.h>
+#include <carl-arith/poly/umvpoly/functions/Substitution.h>
+#include <carl-arith/poly/umvpoly/functions/VarInfo.h>
+#include <carl-common/config.h>
+#include <carl-common/datastructures/Bitset.h>
+
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace carl::fm {
+
+namespace detail {
+
+/**
+ * A constraint c*x + r ~ 0 that is linear in x with a rational coefficient c.
+ */
+template<typename Poly>
+struct LinearForm {
+	typename Poly::NumberType coeff;
+	Poly rest;
+	Relation relation;
+};
+
+/**
+ * Splits the constraint into c*x + r ~ 0.
+ * @return std::nullopt, if the constraint is not linear in x or the coefficient of x is not rational.
+ */
+template<typename Poly>
+std::optional<LinearForm<Poly>> linear_form(const Constraint<Poly>& constraint, Variable x) {
+	auto info = carl::var_info(constraint.lhs(), x, true);
+	if (info.max_degree() != 1) return std::nullopt;
+	auto coeff = info.coeffs().find(1);
+	assert(coeff != info.coeffs().end());
+	if (!coeff->second.is_constant()) return std::nullopt;
+	auto rest = info.coeffs().find(0);
+	return LinearForm<Poly>{
+		coeff->second.constant_part(),
+		rest == info.coeffs().end() ? Poly() : rest->second,
+		constraint.relation()
+	};
+}
+
+}
+
+/**
+ * Eliminates variables from a conjunction of constraints by Fourier-Motzkin elimination.
+ *
+ * Variables with an equality that is linear in them are eliminated by substitution, all other variables by combining every
+ * lower bound with every upper bound. Only the constraints that contain the eliminated variable need to be linear in it,
+ * all other constraints are kept as they are.
+ *
+ * Every constraint carries its history, the original constraints it has been derived from. A derived constraint is
+ * redundant if its history contains more constraints than one plus the number of variables that have been eliminated
+ * from its history, either explicitly or by cancellation (Imbert's first acceleration theorem, which refines Chernikov's rule).
+ * Duplicates are removed by the hash of the pooled constraints.
+ *
+ * The combinations are computed concurrently if parallel is set and carl is built with THREAD_SAFE, otherwise parallel is ignored.
+ */
+template<typename Poly>
+class FourierMotzkin {
+	using Rational = typename Poly::NumberType;
+
+	struct Entry {
+		Constraint<Poly> constraint;
+		/// Indices of the original constraints this constraint is derived from.
+		Bitset history;
+		/// Variables occurring in the original constraints this constraint is derived from, sorted.
+		std::vector<Variable> origin;
+	};
+
+	/// Lower and upper bounds on a variable, together with the entries not containing it.
+	struct Partition {
+		std::vector<std::size_t> unaffected;
+		std::optional<std::size_t> equality;
+		std::vector<std::pair<std::size_t, detail::LinearForm<Poly>>> lower;
+		std::vector<std::pair<std::size_t, detail::LinearForm<Poly>>> upper;
+	};
+
+	std::vector<Entry> mEntries;
+	/// Maps every constraint to its position in mEntries.
+	std::unordered_map<Constraint<Poly>, std::size_t> mIndex;
+	/// Whether all entries are original constraints.
+	bool mOriginal = true;
+	bool mConflict = false;
+	bool mParallel;
+
+	static std::vector<Variable> sorted_variables(const Constraint<Poly>& constraint) {
+		std::vector<Variable> res(constraint.variables().begin(), constraint.variables().end());
+		std::sort(res.begin(), res.end());
+		return res;
+	}
+
+	/// Adds an entry, drops trivially true constraints, detects trivially false constraints and removes duplicates.
+	void insert(Entry&& entry) {
+		if (mConflict) return;
+		switch (entry.constraint.is_consistent()) {
+			case 0:
+				mConflict = true;
+				mEntries.clear();
+				mIndex.clear();
+				return;
+			case 1:
+				return;
+			default:
+				break;
+		}
+		auto it = mIndex.find(entry.constraint);
+		if (it == mIndex.end()) {
+			mIndex.emplace(entry.constraint, mEntries.size());
+			mEntries.emplace_back(std::move(entry));
+		} else if (entry.history.count() < mEntries[it->second].history.count()) {
+			// A smaller history makes more combinations redundant.
+			mEntries[it->second] = std::move(entry);
+		}
+	}
+
+	/// Replaces all entries, keeping the order.
+	void assign(std::vector<Entry>&& entries) {
+		mEntries.clear();
+		mIndex.clear();
+		for (auto& e: entries) insert(std::move(e));
+	}
+
+	/// Makes all entries original constraints.
+	void reset_histories() {
+		if (mOriginal) return;
+		for (std::size_t i = 0; i < mEntries.size(); ++i) {
+			mEntries[i].history = Bitset({i});
+			mEntries[i].origin = sorted_variables(mEntries[i].constraint);
+		}
+		mOriginal = true;
+	}
+
+	/**
+	 * Sorts the entries with respect to x.
+	 * Prefers the equality with the fewest terms, a partition without equality has bounds only.
+	 * @return std::nullopt, if some constraint containing x is not linear in x, or a disequality, and there is no equality to substitute.
+	 */
+	std::optional<Partition> partition(Variable x) const {
+		Partition res;
+		bool eliminable = true;
+		for (std::size_t i = 0; i < mEntries.size(); ++i) {
+			const auto& c = mEntries[i].constraint;
+			if (!c.variables().has(x)) {
+				res.unaffected.push_back(i);
+				continue;
+			}
+			auto form = detail::linear_form(c, x);
+			if (!form || form->relation == Relation::NEQ) {
+				eliminable = false;
+			} else if (form->relation == Relation::EQ) {
+				if (!res.equality || c.lhs().nr_terms() < mEntries[*res.equality].constraint.lhs().nr_terms()) {
+					res.equality = i;
+				}
+			} else {
+				// Normalize to c*x + r < 0 or c*x + r <= 0.
+				if (form->relation == Relation::GREATER || form->relation == Relation::GEQ) {
+					form->coeff = -form->coeff;
+					form->rest = -form->rest;
+					form->relation = form->relation == Relation::GREATER ? Relation::LESS : Relation::LEQ;
+				}
+				if (form->coeff < 0) {
+					res.lower.emplace_back(i, std::move(*form));
+				} else {
+					res.upper.emplace_back(i, std::move(*form));
+				}
+			}
+		}
+		if (!eliminable && !res.equality) return std::nullopt;
+		return res;
+	}
+
+	/// Substitutes the solution of the equality for x into all entries containing x.
+	std::vector<Entry> substitute(const Partition& p, Variable x) const {
+		const auto& eq = mEntries[*p.equality];
+		auto form = detail::linear_form(eq.constraint, x);
+		Poly value = form->rest * Rational(-1 / form->coeff);
+		std::vector<Entry> res;
+		res.reserve(mEntries.size() - 1);
+		for (std::size_t i = 0; i < mEntries.size(); ++i) {
+			if (i == *p.equality) continue;
+			const auto& e = mEntries[i];
+			if (!e.constraint.variables().has(x)) {
+				res.push_back(e);
+				continue;
+			}
+			Constraint<Poly> c(carl::substitute(e.constraint.lhs(), x, value), e.constraint.relation());
+			res.push_back(Entry{ std::move(c), e.history | eq.history, {} });
+		}
+		return res;
+	}
+
+	/**
+	 * Combines a lower and an upper bound on x.
+	 * @return std::nullopt, if the combination is redundant by its history.
+	 */
+	std::optional<Entry> combine(const std::pair<std::size_t, detail::LinearForm<Poly>>& lower, const std::pair<std::size_t, detail::LinearForm<Poly>>& upper) const {
+		const auto& l = mEntries[lower.first];
+		const auto& u = mEntries[upper.first];
+		Bitset history = l.history | u.history;
+		std::vector<Variable> origin;
+		std::set_union(l.origin.begin(), l.origin.end(), u.origin.begin(), u.origin.end(), std::back_inserter(origin));
+		std::size_t size = history.count();
+		// At most all variables of the history can have been eliminated.
+		if (size > origin.size() + 1) return std::nullopt;
+		// upper.coeff * (lower.coeff * x + lower.rest) - lower.coeff * (upper.coeff * x + upper.rest)
+		Poly lhs = lower.second.rest * upper.second.coeff - upper.second.rest * lower.second.coeff;
+		bool strict = lower.second.relation == Relation::LESS || upper.second.relation == Relation::LESS;
+		Constraint<Poly> c(lhs, strict ? Relation::LESS : Relation::LEQ);
+		const auto& vars = c.variables();
+		std::size_t eliminated = std::size_t(std::count_if(origin.begin(), origin.end(), [&vars](Variable v){ return !vars.has(v); }));
+		if (size > eliminated + 1) return std::nullopt;
+		return Entry{ std::move(c), std::move(history), std::move(origin) };
+	}
+
+	/// Computes all non-redundant combinations, in the order of the lower bounds.
+	std::vector<Entry> combine_all(const Partition& p) const {
+		auto combine_range = [&](std::size_t begin, std::size_t end, std::vector<Entry>& res) {
+			for (std::size_t i = begin; i < end; ++i) {
+				for (const auto& u: p.upper) {
+					auto e = combine(p.lower[i], u);
+					if (e) res.emplace_back(std::move(*e));
+				}
+			}
+		};
+		bool parallel = mParallel;
+#ifndef THREAD_SAFE
+		parallel = false;
+#endif
+		std::size_t threads = parallel ? std::min<std::size_t>(std::thread::hardware_concurrency(), p.lower.size()) : 1;
+		std::vector<Entry> res;
+		if (threads > 1) {
+			std::size_t chunk = (p.lower.size() + threads - 1) / threads;
+			std::vector<std::vector<Entry>> results((p.lower.size() + chunk - 1) / chunk);
+			std::vector<std::future<void>> tasks;
+			for (std::size_t i = 0; i < results.size(); ++i) {
+				std::size_t begin = i * chunk;
+				tasks.emplace_back(std::async(std::launch::async, combine_range, begin, std::min(begin + chunk, p.lower.size()), std::ref(results[i])));
+			}
+			for (auto& t: tasks) t.get();
+			for (auto& r: results) {
+				std::move(r.begin(), r.end(), std::back_inserter(res));
+			}
+		} else {
+			combine_range(0, p.lower.size(), res);
+		}
+		return res;
+	}
+
+public:
+	explicit FourierMotzkin(bool parallel = false): mParallel(parallel) {}
+
+	template<typename Constraints>
+	explicit FourierMotzkin(const Constraints& constraints, bool parallel = false): mParallel(parallel) {
+		for (const auto& c: constraints) add(c);
+	}
+
+	/**
+	 * Adds a constraint. It must not contain any variable that has already been eliminated.
+	 */
+	void add(const Constraint<Poly>& constraint) {
+		reset_histories();
+		insert(Entry{ constraint, Bitset({mEntries.size()}), sorted_variables(constraint) });
+	}
+
+	/**
+	 * Eliminates x.
+	 * @return false, if x can not be eliminated, i.e. there is no equality to substitute and some constraint containing x is
+	 *         not linear in x or a disequality. The constraints are not changed in this case.
+	 */
+	bool eliminate(Variable x) {
+		if (mConflict) return true;
+		auto p = partition(x);
+		if (!p) return false;
+		if (p->equality) {
+			assign(substitute(*p, x));
+			mOriginal = false;
+			// The histories do not bound the redundancy after a substitution, hence we start anew.
+			reset_histories();
+			return true;
+		}
+		std::vector<Entry> entries;
+		entries.reserve(p->unaffected.size() + p->lower.size() * p->upper.size());
+		for (auto i: p->unaffected) entries.push_back(mEntries[i]);
+		auto combined = combine_all(*p);
+		std::move(combined.begin(), combined.end(), std::back_inserter(entries));
+		assign(std::move(entries));
+		mOriginal = false;
+		return true;
+	}
+
+	/**
+	 * Eliminates all given variables.
+	 * Greedily picks the next variable: variables with an equality first, then those that produce the fewest combinations.
+	 * @return The variables that could not be eliminated.
+	 */
+	std::vector<Variable> eliminate(std::vector<Variable> variables) {
+		while (!variables.empty() && !mConflict) {
+			std::optional<std::size_t> best;
+			std::size_t best_cost = 0;
+			for (std::size_t i = 0; i < variables.size(); ++i) {
+				auto p = partition(variables[i]);
+				if (!p) continue;
+				std::size_t cost = p->equality ? 0 : p->lower.size() * p->upper.size() + 1;
+				if (!best || cost < best_cost) {
+					best = i;
+					best_cost = cost;
+				}
+				if (cost == 0) break;
+			}
+			if (!best) break;
+			eliminate(variables[*best]);
+			variables.erase(variables.begin() + std::ptrdiff_t(*best));
+		}
+		if (mConflict) return {};
+		return variables;
+	}
+
+	/**
+	 * Enumerates the constraints that eliminating x yields, without storing them.
+	 * Calls f on every constraint until f returns false. Duplicates and redundant combinations are skipped.
+	 * A trivially false constraint is enumerated and stops the enumeration.
+	 * @return std::nullopt, if x can not be eliminated, see eliminate().
+	 *          Whether the enumeration has completed, otherwise.
+	 */
+	template<typename F>
+	std::optional<bool> eliminate_lazy(Variable x, F&& f) const {
+		if (mConflict) {
+			f(Constraint<Poly>(false));
+			return false;
+		}
+		auto p = partition(x);
+		if (!p) return std::nullopt;
+		std::unordered_set<Constraint<Poly>> seen;
+		auto emit = [&](const Constraint<Poly>& c) {
+			switch (c.is_consistent()) {
+				case 0: f(Constraint<Poly>(false)); return false;
+				case 1: return true;
+				default: return !seen.insert(c).second || f(c);
+			}
+		};
+		if (p->equality) {
+			for (const auto& e: substitute(*p, x)) {
+				if (!emit(e.constraint)) return false;
+			}
+			return true;
+		}
+		for (auto i: p->unaffected) {
+			if (!emit(mEntries[i].constraint)) return false;
+		}
+		for (const auto& l: p->lower) {
+			for (const auto& u: p->upper) {
+				auto e = combine(l, u);
+				if (e && !emit(e->constraint)) return false;
+			}
+		}
+		return true;
+	}
+
+	/// Whether the constraints are known to be unsatisfiable.
+	bool is_conflicting() const {
+		return mConflict;
+	}
+
+	/// Number of constraints.
+	std::size_t size() const {
+		return mEntries.size();
+	}
+
+	/// The current constraints, a single trivially false constraint if they are conflicting.
+	std::vector<Constraint<Poly>> constraints() const {
+		if (mConflict) return { Constraint<Poly>(false) };
+		std::vector<Constraint<Poly>> res;
+		res.reserve(mEntries.size());
+		for (const auto& e: mEntries) res.push_back(e.constraint);
+		return res;
+	}
+};
+
+/**
+ * Eliminates the given variables from a conjunction of constraints, see FourierMotzkin.
+ * @return std::nullopt, if some variable can not be eliminated. The resulting constraints, otherwise.
+ */
+template<typename Poly>
+std::optional<std::vector<Constraint<Poly>>> eliminate(const std::vector<Constraint<Poly>>& constraints, const std::vector<Variable>& variables, bool parallel = false) {
+	FourierMotzkin<Poly> fm(constraints, parallel);
+	if (!fm.eliminate(variables).empty()) return std::nullopt;
+	return fm.constraints();
+}
+
+}
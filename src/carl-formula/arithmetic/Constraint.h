@@ -39,11 +39,11 @@ struct CachedConstraintContent {
 	mutable VarsInfo<Pol> m_var_info_map;
 	#ifdef THREAD_SAFE
 	/// Mutex for access to variable information map.
-	std::mutex m_var_info_map_mutex;
+	mutable std::mutex m_var_info_map_mutex;
 	/// Mutex for access to the factorization.
-	std::mutex m_lhs_factorization_mutex;
+	mutable std::mutex m_lhs_factorization_mutex;
 	/// Mutex for access to the variables.
-	std::mutex m_variables_mutex;
+	mutable std::mutex m_variables_mutex;
 	#endif
 
 	CachedConstraintContent(BasicConstraint<Pol>&& c) : m_constraint(std::move(c)) {}
@@ -44,6 +44,9 @@ public:
 	}
 #endif
 	BVValue(std::size_t _width, const mpz_class& _value);
+	BVValue(std::size_t _width, const SmallInteger& _value)
+		: BVValue(_width, _value.to_mpz()) {
+	}
 
 	template<typename BlockInputIterator>
 	explicit BVValue(BlockInputIterator _first, BlockInputIterator _last)
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace carl::vs {
+
+/**
+ * Lazily enumerates the combinations of a list of disjunctions of conjunctions, i.e. converts their conjunction to disjunctive normal form.
+ * A combination picks one conjunction from every disjunction and merges them.
+ * Combinations are only materialized when the iterator is dereferenced, thus enumeration can stop at any point.
+ */
+template<typename T>
+class Combinations {
+	using Disjunction = std::vector<std::vector<T>>;
+	const std::vector<Disjunction>& mFactors;
+public:
+	class iterator {
+		const std::vector<Disjunction>* mFactors = nullptr;
+		std::vector<std::size_t> mIndices;
+		bool mEnd = true;
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = std::vector<T>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const value_type*;
+		using reference = value_type;
+
+		iterator() = default;
+		explicit iterator(const std::vector<Disjunction>& factors): mFactors(&factors), mIndices(factors.size(), 0), mEnd(false) {
+			for (const auto& f: factors) {
+				if (f.empty()) mEnd = true;
+			}
+		}
+
+		/// Indices of the chosen conjunctions.
+		const std::vector<std::size_t>& indices() const {
+			return mIndices;
+		}
+
+		value_type operator*() const {
+			value_type res;
+			for (std::size_t i = 0; i < mIndices.size(); ++i) {
+				const auto& conj = (*mFactors)[i][mIndices[i]];
+				res.insert(res.end(), conj.begin(), conj.end());
+			}
+			return res;
+		}
+		/// Advances like a mixed-radix counter, the first factor varies fastest.
+		iterator& operator++() {
+			for (std::size_t i = 0; i < mIndices.size(); ++i) {
+				if (++mIndices[i] < (*mFactors)[i].size()) return *this;
+				mIndices[i] = 0;
+			}
+			mEnd = true;
+			return *this;
+		}
+		bool operator==(const iterator& rhs) const {
+			if (mEnd || rhs.mEnd) return mEnd == rhs.mEnd;
+			return mIndices == rhs.mIndices;
+		}
+		bool operator!=(const iterator& rhs) const {
+			return !(*this == rhs);
+		}
+	};
+
+	explicit Combinations(const std::vector<Disjunction>& factors): mFactors(factors) {}
+
+	iterator begin() const {
+		return iterator(mFactors);
+	}
+	iterator end() const {
+		return iterator();
+	}
+	/// Number of combinations, saturates at the maximum of std::size_t.
+	std::size_t size() const {
+		std::size_t res = 1;
+		for (const auto& f: mFactors) {
+			if (f.empty()) return 0;
+			if (res > std::numeric_limits<std::size_t>::max() / f.size()) return std::numeric_limits<std::size_t>::max();
+			res *= f.size();
+		}
+		return res;
+	}
+};
+
+}
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <bitset>
+#include <future>
+#include <thread>
 #include <vector>
+#include <carl-common/config.h>
 #include <carl-formula/arithmetic/Constraint.h>
 
+#include "combinations.h"
 #include "term.h"
 #include "zeros.h"
 
@@ -388,6 +393,96 @@ namespace carl::vs {
         }
     }
 
+    /**
+     * Applies a substitution to every constraint of a conjunction.
+     * The substitutions are independent of each other. If parallel is set and carl is built with THREAD_SAFE,
+     * they are computed concurrently, otherwise parallel is ignored.
+     * Every resulting case distinction is simplified: trivially false cases are removed, trivially true constraints are dropped
+     * and an empty (trivially true) case is moved to the front.
+     * @return std::nullopt, if any substitution exceeds the upper limit in the number of combinations.
+     *          The case distinction for every constraint, otherwise.
+     */
+    template<typename Poly>
+    inline std::optional<std::vector<CaseDistinction<Poly>>> substitute_each(const ConstraintConjunction<Poly>& conj, const Variable var, const Term<Poly>& term, bool parallel = false) {
+        std::vector<std::optional<CaseDistinction<Poly>>> results(conj.size());
+        auto substitute_range = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                results[i] = substitute(conj[i], var, term);
+                if (!results[i]) return;
+                detail::simplify(*results[i]);
+                std::stable_partition(results[i]->begin(), results[i]->end(), [](const auto& c) { return c.empty(); });
+            }
+        };
+#ifndef THREAD_SAFE
+        parallel = false;
+#endif
+        std::size_t threads = parallel ? std::min<std::size_t>(std::thread::hardware_concurrency(), conj.size()) : 1;
+        if (threads > 1) {
+            std::vector<std::future<void>> tasks;
+            std::size_t chunk = (conj.size() + threads - 1) / threads;
+            for (std::size_t begin = 0; begin < conj.size(); begin += chunk) {
+                tasks.emplace_back(std::async(std::launch::async, substitute_range, begin, std::min(begin + chunk, conj.size())));
+            }
+            for (auto& t: tasks) t.get();
+        } else {
+            substitute_range(0, conj.size());
+        }
+        std::vector<CaseDistinction<Poly>> res;
+        res.reserve(results.size());
+        for (auto& r: results) {
+            if (!r) return std::nullopt;
+            res.emplace_back(std::move(*r));
+        }
+        return res;
+    }
+
+    /**
+     * Applies a substitution to a conjunction of constraints and enumerates the cases of the result lazily.
+     * Calls f on every case until f returns false. No case is enumerated if the result is trivially false,
+     * and if the result is trivially true, the first case is empty.
+     * @param f Callback taking a ConstraintConjunction<Poly> and returning whether to continue.
+     * @param parallel Whether the substitutions into the constraints are computed concurrently, see substitute_each().
+     * @return std::nullopt, if a substitution exceeds the upper limit in the number of combinations.
+     *          Whether all cases have been enumerated, otherwise.
+     */
+    template<typename Poly, typename F>
+    inline std::optional<bool> substitute_lazy(const ConstraintConjunction<Poly>& conj, const Variable var, const Term<Poly>& term, F&& f, bool parallel = false) {
+        auto factors = substitute_each(conj, var, term, parallel);
+        if (!factors) return std::nullopt;
+        Combinations<Constraint<Poly>> combinations(*factors);
+        for (auto it = combinations.begin(); it != combinations.end(); ++it) {
+            if (!f(*it)) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Applies a substitution to a conjunction of constraints.
+     * Stops as soon as a trivially true case is found, and returns it as the only case.
+     * @return std::nullopt, if the result has more than max_cases cases or a substitution exceeds the upper limit in the number of combinations.
+     *          The substitution result, otherwise.
+     */
+    template<typename Poly>
+    inline std::optional<CaseDistinction<Poly>> substitute(const ConstraintConjunction<Poly>& conj, const Variable var, const Term<Poly>& term, bool parallel = false, std::size_t max_cases = MAX_NUM_OF_COMBINATION_RESULT) {
+        CaseDistinction<Poly> result;
+        bool exceeded = false;
+        auto res = substitute_lazy(conj, var, term, [&](ConstraintConjunction<Poly>&& c) {
+            if (c.empty()) {
+                result.clear();
+                result.emplace_back();
+                return false;
+            }
+            if (result.size() >= max_cases) {
+                exceeded = true;
+                return false;
+            }
+            result.emplace_back(std::move(c));
+            return true;
+        }, parallel);
+        if (!res || exceeded) return std::nullopt;
+        return result;
+    }
+
     /**
      * Applies a substitution to a variable comparison.
      * @param varcomp   The variable comparison to substitute in.
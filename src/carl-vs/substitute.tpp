@@ -616,7 +616,7 @@ namespace carl::vs::detail
             {
                 return false;
             }
-            carl::SqrtEx sub = carl::substitute( _cons.lhs(), _subs.variable(), _subs.term().sqrt_ex() );
+            carl::SqrtEx sub = carl::substitute( _cons.lhs(), _subs.variable(), _subs.term().pooled_sqrt_ex() );
             #ifdef VS_DEBUG_SUBSTITUTION
             std::cout << "Result of common substitution:" << sub << std::endl;
             #endif
@@ -1000,7 +1000,7 @@ namespace carl::vs::detail
     {
         assert( _cons.variables().has( _subs.variable() ) );
         // Create a substitution formed by the given one without an addition of epsilon.
-        auto term = Term<Poly>::normal(_subs.term().sqrt_ex());
+        auto term = Term<Poly>::normal(_subs.term().pooled_sqrt_ex());
         // Call the method substituteNormal with the constraint f(x)~0 and the substitution [x -> t],  where the parameter relation is ~.
         Constraint<Poly> firstCaseInequality = Constraint<Poly>( _cons.lhs(), _relation );
         if( !substituteNormal( firstCaseInequality, {_subs.variable(), term}, _result, _accordingPaper, _conflictingVariables, _solutionSpace ) )
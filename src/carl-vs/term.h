@@ -1,6 +1,7 @@
 #pragma once
 
 #include <carl-arith/vs/SqrtEx.h>
+#include <carl-arith/vs/PooledSqrtEx.h>
 
 namespace carl::vs {
 
@@ -16,13 +17,18 @@ class Term {
 private:                    
 	/// The substitution type.
 	TermType m_type;
-	/// A square root expression.
-	std::optional<SqrtEx<Poly>> m_sqrt_ex;
+	/// A square root expression, pooled such that equal test candidates share it.
+	std::optional<PooledSqrtEx<Poly>> m_sqrt_ex;
 
 public:
-	Term(TermType type, std::optional<SqrtEx<Poly>> sqrt_ex)
+	Term(TermType type, const PooledSqrtEx<Poly>& sqrt_ex)
 		: m_type(type), m_sqrt_ex(sqrt_ex) {}
 
+	Term(TermType type, const std::optional<SqrtEx<Poly>>& sqrt_ex)
+		: m_type(type) {
+		if (sqrt_ex) m_sqrt_ex.emplace(*sqrt_ex);
+	}
+
 	static Term normal(const SqrtEx<Poly>& sqrt_ex) {
 		return Term(TermType::NORMAL, sqrt_ex);
 	}
@@ -31,6 +37,14 @@ public:
 		return Term(TermType::PLUS_EPSILON, sqrt_ex);
 	}
 
+	static Term normal(const PooledSqrtEx<Poly>& sqrt_ex) {
+		return Term(TermType::NORMAL, sqrt_ex);
+	}
+
+	static Term plus_eps(const PooledSqrtEx<Poly>& sqrt_ex) {
+		return Term(TermType::PLUS_EPSILON, sqrt_ex);
+	}
+
 	static Term minus_infty() {
 		return Term(TermType::MINUS_INFINITY, std::nullopt);
 	}
@@ -55,7 +69,11 @@ public:
 		return m_type == TermType::PLUS_INFINITY;
 	}
 
-	const SqrtEx<Poly> sqrt_ex() const {
+	const SqrtEx<Poly>& sqrt_ex() const {
+		return m_sqrt_ex->sqrt_ex();
+	}
+
+	const PooledSqrtEx<Poly>& pooled_sqrt_ex() const {
 		return *m_sqrt_ex;
 	}
 
@@ -76,7 +94,8 @@ template<class Poly>
 struct hash<carl::vs::Term<Poly>> {
 public:
 	size_t operator()(const carl::vs::Term<Poly>& term) const {
-		return ((hash<carl::SqrtEx<Poly>>()(term.sqrt_ex()) << 5) ^ term.type());
+		if (term.is_minus_infty() || term.is_plus_infty()) return static_cast<size_t>(term.type());
+		return (term.pooled_sqrt_ex().hash() << 5) ^ static_cast<size_t>(term.type());
 	}
 };
 } // namespace std
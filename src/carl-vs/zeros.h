@@ -1,7 +1,15 @@
 #pragma once
 
 #include <carl-arith/vs/SqrtEx.h>
+#include <carl-common/config.h>
+#include <carl-common/datastructures/MemoizingCache.h>
+#include <carl-common/util/hash.h>
+
+#include <algorithm>
+#include <future>
+#include <memory>
 #include <optional>
+#include <thread>
 #include <vector>
 
 namespace carl::vs {
@@ -20,16 +28,13 @@ std::ostream& operator<<(std::ostream& out, const zero<Poly>& z) {
     return out;
 }
 
+namespace detail {
 /**
- * Gathers zeros with side conditions from the given constraint in the given variable.
+ * Computes the zeros with side conditions of the given constraint in the given variable, see gather_zeros().
  */
 template<typename Poly>
-static bool gather_zeros(const Constraint<Poly>& constraint, const Variable& eliminationVar, std::vector<zero<Poly>>& results) {
+bool compute_zeros(const Constraint<Poly>& constraint, const Variable& eliminationVar, std::vector<zero<Poly>>& results) {
 	using Rational = typename Poly::NumberType;
-    
-    if (!constraint.variables().has(eliminationVar)) {
-		return true;
-	}
 
 	std::vector<Poly> factors;
 	Constraints<Poly> sideConditions;
@@ -134,6 +139,124 @@ static bool gather_zeros(const Constraint<Poly>& constraint, const Variable& eli
 	}
 	return true;
 }
+}
+
+/**
+ * Memoizes the zeros of constraints.
+ *
+ * Virtual substitution gathers the zeros of the same constraints in every branch of the search.
+ * If a cache is installed globally via set_global(), gather_zeros() answers from this cache.
+ *
+ * Entries are identified by the constraint and the elimination variable. The cache is bounded by the number of entries,
+ * the least recently used entries are evicted first.
+ * All methods are thread-safe, see MemoizingCache.
+ */
+template<typename Poly>
+class ZeroCache: public GlobalInstance<ZeroCache<Poly>> {
+public:
+	struct Entry {
+		/// Whether all zeros could be gathered, i.e. no factor has a degree greater than two.
+		bool success;
+		std::vector<zero<Poly>> zeros;
+	};
+private:
+	using Key = std::pair<Constraint<Poly>, Variable>;
+	struct KeyHash {
+		std::size_t operator()(const Key& key) const {
+			return carl::hash_all(key.first, key.second);
+		}
+	};
+
+	MemoizingCache<Key, const Entry, KeyHash> mEntries;
+public:
+	/**
+	 * @param capacity Maximum number of entries.
+	 */
+	explicit ZeroCache(std::size_t capacity = 100000): mEntries(capacity) {}
+
+	/// Returns the zeros of the constraint in the given variable.
+	std::shared_ptr<const Entry> get(const Constraint<Poly>& constraint, const Variable& eliminationVar) {
+		return mEntries.get(Key(constraint, eliminationVar), [&]() {
+			auto entry = std::make_shared<Entry>();
+			entry->success = detail::compute_zeros(constraint, eliminationVar, entry->zeros);
+			return entry;
+		});
+	}
+	/// Appends the zeros of the constraint to results, see gather_zeros().
+	bool gather(const Constraint<Poly>& constraint, const Variable& eliminationVar, std::vector<zero<Poly>>& results) {
+		auto entry = get(constraint, eliminationVar);
+		results.insert(results.end(), entry->zeros.begin(), entry->zeros.end());
+		return entry->success;
+	}
+
+	/// Changes the capacity, evicting entries if necessary.
+	void set_capacity(std::size_t capacity) {
+		mEntries.set_capacity(capacity);
+	}
+	void clear() {
+		mEntries.clear();
+	}
+
+	/// Number of entries in the cache.
+	std::size_t entries() const {
+		return mEntries.entries();
+	}
+	std::size_t hits() const {
+		return mEntries.hits();
+	}
+	std::size_t misses() const {
+		return mEntries.misses();
+	}
+};
+
+/**
+ * Gathers zeros with side conditions from the given constraint in the given variable.
+ * Uses the global ZeroCache, if one is installed.
+ */
+template<typename Poly>
+static bool gather_zeros(const Constraint<Poly>& constraint, const Variable& eliminationVar, std::vector<zero<Poly>>& results) {
+	if (!constraint.variables().has(eliminationVar)) {
+		return true;
+	}
+	if (auto* cache = ZeroCache<Poly>::global()) {
+		return cache->gather(constraint, eliminationVar, results);
+	}
+	return detail::compute_zeros(constraint, eliminationVar, results);
+}
+
+/**
+ * Gathers the zeros of all given constraints in the given variable, see gather_zeros().
+ * The constraints are independent of each other. If parallel is set and carl is built with THREAD_SAFE,
+ * they are processed concurrently, otherwise parallel is ignored.
+ * @return For every constraint its zeros, or std::nullopt if they could not be gathered.
+ */
+template<typename Poly>
+std::vector<std::optional<std::vector<zero<Poly>>>> gather_all_zeros(const std::vector<Constraint<Poly>>& constraints, const Variable& eliminationVar, bool parallel = false) {
+	std::vector<std::optional<std::vector<zero<Poly>>>> results(constraints.size());
+	auto gather_range = [&](std::size_t begin, std::size_t end) {
+		for (std::size_t i = begin; i < end; ++i) {
+			std::vector<zero<Poly>> zeros;
+			if (gather_zeros(constraints[i], eliminationVar, zeros)) {
+				results[i] = std::move(zeros);
+			}
+		}
+	};
+#ifndef THREAD_SAFE
+	parallel = false;
+#endif
+	std::size_t threads = parallel ? std::min<std::size_t>(std::thread::hardware_concurrency(), constraints.size()) : 1;
+	if (threads > 1) {
+		std::vector<std::future<void>> tasks;
+		std::size_t chunk = (constraints.size() + threads - 1) / threads;
+		for (std::size_t begin = 0; begin < constraints.size(); begin += chunk) {
+			tasks.emplace_back(std::async(std::launch::async, gather_range, begin, std::min(begin + chunk, constraints.size())));
+		}
+		for (auto& t: tasks) t.get();
+	} else {
+		gather_range(0, constraints.size());
+	}
+	return results;
+}
 
 template<typename Poly>
 static bool gather_zeros(const VariableComparison<Poly>& varcomp, const Variable& eliminationVar, std::vector<zero<Poly>>& results) {
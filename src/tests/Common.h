@@ -17,14 +17,16 @@ using IntegerTypes = testing::Types<
 	#ifdef USE_CLN_NUMBERS
 	cln::cl_I,
 	#endif
-	mpz_class
+	mpz_class,
+	carl::SmallInteger
 >;
 
 using RationalTypes = testing::Types<
 	#ifdef USE_CLN_NUMBERS
 	cln::cl_RA,
 	#endif
-	mpq_class
+	mpq_class,
+	carl::SmallRational
 >;
 
 using NumberTypes = testing::Types<
@@ -0,0 +1,69 @@
+#include <carl-common/datastructures/MemoizingCache.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+using Cache = carl::MemoizingCache<int, const std::string>;
+
+TEST(MemoizingCache, Get)
+{
+	Cache cache(2);
+	std::size_t computed = 0;
+	auto compute = [&computed](int key) {
+		return [&computed, key]() {
+			++computed;
+			return std::make_shared<const std::string>(std::to_string(key));
+		};
+	};
+	EXPECT_EQ(*cache.get(1, compute(1)), "1");
+	EXPECT_EQ(*cache.get(1, compute(1)), "1");
+	EXPECT_EQ(computed, 1u);
+	EXPECT_EQ(cache.hits(), 1u);
+	EXPECT_EQ(cache.misses(), 1u);
+
+	// The least recently used result is evicted.
+	cache.get(2, compute(2));
+	cache.get(1, compute(1));
+	cache.get(3, compute(3));
+	EXPECT_EQ(cache.entries(), 2u);
+	EXPECT_NE(cache.find(1), nullptr);
+	EXPECT_EQ(cache.find(2), nullptr);
+
+	// A result that is stored already wins.
+	auto value = std::make_shared<const std::string>("other");
+	EXPECT_EQ(cache.insert(1, value), 0u);
+	EXPECT_EQ(*value, "1");
+
+	EXPECT_EQ(cache.set_capacity(1), 1u);
+	EXPECT_EQ(cache.entries(), 1u);
+	cache.clear();
+	EXPECT_EQ(cache.entries(), 0u);
+}
+
+TEST(MemoizingCache, Weight)
+{
+	Cache cache(5, [](const std::string& s) { return s.size(); });
+	auto value = [](const std::string& s) { return [s]() { return std::make_shared<const std::string>(s); }; };
+	cache.get(1, value("abc"));
+	cache.get(2, value("de"));
+	EXPECT_EQ(cache.size(), 5u);
+	cache.get(3, value("f"));
+	EXPECT_EQ(cache.entries(), 2u);
+	EXPECT_EQ(cache.size(), 3u);
+	// Results that exceed the capacity are returned, but not stored.
+	EXPECT_EQ(*cache.get(4, value("ghijkl")), "ghijkl");
+	EXPECT_EQ(cache.entries(), 2u);
+}
+
+namespace {
+struct Global: carl::GlobalInstance<Global> {};
+}
+
+TEST(MemoizingCache, GlobalInstance)
+{
+	Global g;
+	EXPECT_EQ(Global::global(), nullptr);
+	EXPECT_EQ(Global::set_global(&g), nullptr);
+	EXPECT_EQ(Global::global(), &g);
+	EXPECT_EQ(Global::set_global(nullptr), &g);
+}
@@ -0,0 +1,165 @@
+#include "gtest/gtest.h"
+#include <carl-arith/core/VariablePool.h>
+#include <carl-fm/fourier_motzkin.h>
+
+#include "../Common.h"
+
+#include <random>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+namespace {
+
+std::vector<bool> parallel_modes() {
+	std::vector<bool> modes = {false};
+#ifdef THREAD_SAFE
+	modes.push_back(true);
+#endif
+	return modes;
+}
+
+/**
+ * Generates constraints with small integer coefficients in the given variables that are satisfied by the given point.
+ */
+std::vector<Constraint<Poly>> random_system(std::mt19937& rng, const std::vector<Variable>& vars, const Assignment<Rational>& point, std::size_t size) {
+	std::vector<Constraint<Poly>> res;
+	while (res.size() < size) {
+		Poly lhs;
+		for (auto v: vars) {
+			if (rng() % 3 != 0) continue;
+			int coeff = int(rng() % 7) - 3;
+			if (coeff == 0) continue;
+			lhs += Rational(coeff) * (Poly(v) - point.at(v));
+		}
+		if (lhs.is_constant()) continue;
+		// Keep a positive slack, such that strict constraints are satisfied as well.
+		lhs -= Rational(int(rng() % 3) + 1);
+		res.emplace_back(lhs, rng() % 2 == 0 ? Relation::LEQ : Relation::LESS);
+	}
+	return res;
+}
+
+}
+
+TEST(FourierMotzkin, Basic)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	// 0 <= x <= y < 3, x + z = 2, z >= 1
+	std::vector<Constraint<Poly>> constraints = {
+		Constraint<Poly>(Poly(x), Relation::GEQ),
+		Constraint<Poly>(Poly(x) - Poly(y), Relation::LEQ),
+		Constraint<Poly>(Poly(y) - Rational(3), Relation::LESS),
+		Constraint<Poly>(Poly(x) + Poly(z) - Rational(2), Relation::EQ),
+		Constraint<Poly>(Poly(z) - Rational(1), Relation::GEQ),
+	};
+	for (bool parallel: parallel_modes()) {
+		auto res = fm::eliminate(constraints, {x, z}, parallel);
+		ASSERT_TRUE(res);
+		for (const auto& c: *res) {
+			EXPECT_FALSE(c.variables().has(x));
+			EXPECT_FALSE(c.variables().has(z));
+		}
+		// y = 0 is a solution, y = 3 is not.
+		for (const auto& c: *res) {
+			EXPECT_NE(satisfied_by(c, Assignment<Rational>({{y, Rational(0)}})), 0);
+		}
+		EXPECT_TRUE(std::any_of(res->begin(), res->end(), [y](const auto& c) {
+			return satisfied_by(c, Assignment<Rational>({{y, Rational(3)}})) == 0;
+		}));
+
+		res = fm::eliminate(constraints, {x, y, z}, parallel);
+		ASSERT_TRUE(res);
+		for (const auto& c: *res) EXPECT_NE(c.is_consistent(), 0);
+
+		auto unsat = constraints;
+		unsat.emplace_back(Poly(y) - Rational(5), Relation::GEQ);
+		fm::FourierMotzkin<Poly> f(unsat, parallel);
+		EXPECT_TRUE(f.eliminate({x, y, z}).empty());
+		EXPECT_TRUE(f.is_conflicting());
+		EXPECT_EQ(f.constraints(), std::vector<Constraint<Poly>>({Constraint<Poly>(false)}));
+	}
+}
+
+TEST(FourierMotzkin, Nonlinear)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::vector<Constraint<Poly>> constraints = {
+		Constraint<Poly>(Poly(x) * Poly(y) - Rational(1), Relation::LESS),
+		Constraint<Poly>(Poly(y) - Poly(x), Relation::LEQ),
+	};
+	EXPECT_FALSE(fm::eliminate(constraints, {y}));
+	fm::FourierMotzkin<Poly> f(constraints);
+	EXPECT_FALSE(f.eliminate(y));
+	EXPECT_EQ(f.size(), 2);
+	EXPECT_FALSE(f.eliminate_lazy(y, [](const auto&) { return true; }));
+	// The coefficient of x is not rational either.
+	EXPECT_FALSE(f.eliminate(x));
+	EXPECT_EQ(f.eliminate({x, y}), std::vector<Variable>({x, y}));
+}
+
+TEST(FourierMotzkin, RandomFeasibility)
+{
+	std::mt19937 rng(1);
+	std::vector<Variable> vars;
+	for (std::size_t i = 0; i < 6; ++i) vars.emplace_back(fresh_real_variable("v" + std::to_string(i)));
+	for (bool parallel: parallel_modes()) {
+		for (std::size_t round = 0; round < 50; ++round) {
+			Assignment<Rational> point;
+			for (auto v: vars) point.emplace(v, Rational(int(rng() % 11) - 5));
+			auto system = random_system(rng, vars, point, 16);
+			bool feasible = round % 2 == 0;
+			if (!feasible) {
+				// The sum of all variables is at least 100 and at most 99.
+				Poly sum;
+				for (auto v: vars) sum += Poly(v);
+				system.emplace_back(sum - Rational(100), Relation::GEQ);
+				system.emplace_back(sum - Rational(99), Relation::LEQ);
+			}
+			fm::FourierMotzkin<Poly> f(system, parallel);
+			EXPECT_TRUE(f.eliminate(vars).empty());
+			EXPECT_EQ(f.is_conflicting(), !feasible);
+		}
+	}
+}
+
+TEST(FourierMotzkin, RandomProjection)
+{
+	std::mt19937 rng(2);
+	std::vector<Variable> vars;
+	for (std::size_t i = 0; i < 6; ++i) vars.emplace_back(fresh_real_variable("w" + std::to_string(i)));
+	std::vector<Variable> eliminated(vars.begin(), vars.begin() + 3);
+	for (std::size_t round = 0; round < 50; ++round) {
+		Assignment<Rational> point;
+		for (auto v: vars) point.emplace(v, Rational(int(rng() % 11) - 5));
+		auto system = random_system(rng, vars, point, 12);
+
+		// The projection of a solution satisfies the projected constraints.
+		fm::FourierMotzkin<Poly> f(system);
+		EXPECT_TRUE(f.eliminate(eliminated).empty());
+		EXPECT_FALSE(f.is_conflicting());
+		for (const auto& c: f.constraints()) {
+			for (auto v: eliminated) EXPECT_FALSE(c.variables().has(v));
+			EXPECT_EQ(satisfied_by(c, point), 1);
+		}
+
+		// Lazy elimination enumerates the same constraints.
+		fm::FourierMotzkin<Poly> g(system);
+		std::vector<Constraint<Poly>> lazy;
+		auto complete = g.eliminate_lazy(vars[0], [&lazy](const Constraint<Poly>& c) {
+			lazy.emplace_back(c);
+			return true;
+		});
+		ASSERT_TRUE(complete);
+		EXPECT_TRUE(*complete);
+		g.eliminate(vars[0]);
+		auto eager = g.constraints();
+		std::sort(lazy.begin(), lazy.end());
+		std::sort(eager.begin(), eager.end());
+		EXPECT_EQ(lazy, eager);
+	}
+}
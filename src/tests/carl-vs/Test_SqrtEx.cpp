@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include <carl-arith/extended/VariableComparison.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/vs/Substitution.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(SqrtEx, Normalize)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly px(x), py(y), pz(z);
+	auto expect = [](const SqrtEx<Poly>& s, const Poly& q, const Poly& r, const Poly& d, const Poly& t) {
+		EXPECT_EQ(s.constant_part(), q);
+		EXPECT_EQ(s.factor(), r);
+		EXPECT_EQ(s.denominator(), d);
+		EXPECT_EQ(s.radicand(), t);
+	};
+	// A positive semi-definite common divisor is cancelled.
+	expect(SqrtEx<Poly>(px*px*py, px*px, px*px, pz), py, Poly(1), Poly(1), pz);
+	expect(SqrtEx<Poly>(px*px*py, px*px*Rational(2), px*px*(py+Rational(1)), pz), py, Poly(2), py+Rational(1), pz);
+	// Other common divisors are kept, in particular linear ones.
+	expect(SqrtEx<Poly>(px*py, px, px, pz), px*py, px, px, pz);
+	expect(SqrtEx<Poly>(px*py*Rational(2), px*Rational(4), px*Rational(6), pz), px*py, px*Rational(2), px*Rational(3), pz);
+	expect(SqrtEx<Poly>((px*px-Rational(1))*py, Poly(), px*px-Rational(1), Poly()), (px*px-Rational(1))*py, Poly(), px*px-Rational(1), Poly());
+	// Rational factors are always normalized.
+	expect(SqrtEx<Poly>(py*Rational(2)+Rational(4), Poly(), Poly(6), Poly()), py+Rational(2), Poly(), Poly(3), Poly());
+}
+
+TEST(SqrtEx, Pool)
+{
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly py(y), pz(z);
+	PooledSqrtEx<Poly> a(SqrtEx<Poly>(py*Rational(2)+Rational(4), Poly(2), Poly(6), pz));
+	PooledSqrtEx<Poly> b(SqrtEx<Poly>(py+Rational(2), Poly(1), Poly(3), pz));
+	PooledSqrtEx<Poly> c(SqrtEx<Poly>(py+Rational(2), Poly(-1), Poly(3), pz));
+	EXPECT_EQ(a.sqrt_ex(), b.sqrt_ex());
+	EXPECT_EQ(a.id(), b.id());
+	EXPECT_EQ(a, b);
+	EXPECT_EQ(a.hash(), b.hash());
+	EXPECT_EQ(std::hash<PooledSqrtEx<Poly>>()(a), a.sqrt_ex().hash());
+	EXPECT_NE(a.id(), c.id());
+	EXPECT_NE(a, c);
+}
+
+TEST(SqrtEx, PooledSubstitution)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly px(x), py(y), pz(z);
+	SqrtEx<Poly> s(py, Poly(2), Poly(3), pz);
+	PooledSqrtEx<Poly> pooled(s);
+	std::vector<Poly> polys = {
+		px*px*px*py + px*px*Rational(2) - px + Rational(5),
+		px*px*px*px*px - py*px*px*px*px + Rational(1),
+		px*px*px*px - pz*px,
+	};
+	std::vector<std::size_t> degrees = {3, 5, 5};
+	for (std::size_t i = 0; i < polys.size(); ++i) {
+		EXPECT_EQ(carl::substitute(polys[i], x, pooled), carl::substitute(polys[i], x, s));
+		// The cached powers grow with the degree of the polynomials.
+		EXPECT_EQ(pooled.powers(0)->degree(), degrees[i]);
+	}
+	// Equal square root expressions share the cached powers.
+	EXPECT_EQ(PooledSqrtEx<Poly>(s).powers(0), pooled.powers(0));
+}
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include <carl-arith/extended/VariableComparison.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-vs/substitute.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(VS, Combinations)
+{
+	using Disjunction = std::vector<std::vector<int>>;
+	std::vector<Disjunction> factors = {
+		{ {1}, {2} },
+		{ {3}, {4, 5}, {6} }
+	};
+	vs::Combinations<int> combinations(factors);
+	EXPECT_EQ(combinations.size(), 6);
+	std::vector<std::vector<int>> res(combinations.begin(), combinations.end());
+	// The first factor varies fastest.
+	std::vector<std::vector<int>> expected = {
+		{1, 3}, {2, 3}, {1, 4, 5}, {2, 4, 5}, {1, 6}, {2, 6}
+	};
+	EXPECT_EQ(res, expected);
+
+	factors.emplace_back();
+	vs::Combinations<int> empty(factors);
+	EXPECT_EQ(empty.size(), 0);
+	EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(VS, TermHash)
+{
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	std::hash<vs::Term<Poly>> hash;
+	SqrtEx<Poly> s(Poly(y), Poly(1), Poly(2), Poly(z));
+	EXPECT_EQ(hash(vs::Term<Poly>::minus_infty()), hash(vs::Term<Poly>::minus_infty()));
+	EXPECT_EQ(hash(vs::Term<Poly>::plus_infty()), hash(vs::Term<Poly>::plus_infty()));
+	EXPECT_NE(hash(vs::Term<Poly>::minus_infty()), hash(vs::Term<Poly>::plus_infty()));
+	EXPECT_EQ(hash(vs::Term<Poly>::normal(s)), hash(vs::Term<Poly>::normal(PooledSqrtEx<Poly>(s))));
+	EXPECT_NE(hash(vs::Term<Poly>::normal(s)), hash(vs::Term<Poly>::plus_eps(s)));
+}
+
+TEST(VS, SubstituteConjunction)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	vs::ConstraintConjunction<Poly> conj = {
+		Constraint<Poly>(Poly(x) * Poly(x) - Poly(z), Relation::LESS),
+		Constraint<Poly>(Poly(x) * Poly(y) + Rational(1), Relation::GEQ),
+		Constraint<Poly>(Poly(x) * Poly(x) * Poly(x) - Poly(y), Relation::NEQ),
+		Constraint<Poly>(Poly(y) - Poly(z) - Rational(2), Relation::EQ)
+	};
+
+	// Test candidates from the zeros of x^2 - y.
+	std::vector<vs::zero<Poly>> zeros;
+	ASSERT_TRUE(vs::gather_zeros(Constraint<Poly>(Poly(x) * Poly(x) - Poly(y), Relation::EQ), x, zeros));
+	ASSERT_FALSE(zeros.empty());
+	std::vector<vs::Term<Poly>> terms = { vs::Term<Poly>::minus_infty() };
+	for (const auto& zero: zeros) {
+		terms.emplace_back(vs::Term<Poly>::normal(zero.sqrt_ex));
+		terms.emplace_back(vs::Term<Poly>::plus_eps(zero.sqrt_ex));
+	}
+
+	for (const auto& term: terms) {
+		auto factors = vs::substitute_each(conj, x, term);
+		ASSERT_TRUE(factors);
+		EXPECT_EQ(factors->size(), conj.size());
+
+		auto eager = vs::substitute(conj, x, term);
+		auto parallel = vs::substitute(conj, x, term, true);
+		vs::CaseDistinction<Poly> lazy;
+		auto complete = vs::substitute_lazy(conj, x, term, [&lazy](vs::ConstraintConjunction<Poly>&& c) {
+			lazy.emplace_back(std::move(c));
+			return true;
+		});
+		ASSERT_TRUE(eager);
+		ASSERT_TRUE(parallel);
+		ASSERT_TRUE(complete);
+		EXPECT_TRUE(*complete);
+		EXPECT_EQ(*eager, *parallel);
+		if (!lazy.empty() && lazy.front().empty()) {
+			// The result is trivially true, which substitute() returns as the only case.
+			EXPECT_EQ(*eager, vs::CaseDistinction<Poly>(1));
+		} else {
+			EXPECT_EQ(*eager, lazy);
+			EXPECT_EQ(lazy.size(), vs::Combinations<Constraint<Poly>>(*factors).size());
+		}
+
+		// Enumeration stops as soon as the callback returns false.
+		std::size_t calls = 0;
+		auto stopped = vs::substitute_lazy(conj, x, term, [&calls](vs::ConstraintConjunction<Poly>&&) {
+			++calls;
+			return false;
+		}, true);
+		ASSERT_TRUE(stopped);
+		EXPECT_EQ(*stopped, lazy.empty());
+		EXPECT_EQ(calls, lazy.empty() ? 0 : 1);
+	}
+}
@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+#include <carl-arith/extended/VariableComparison.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-vs/zeros.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+namespace carl::vs {
+bool operator==(const vs::zero<Poly>& lhs, const vs::zero<Poly>& rhs) {
+	return lhs.sqrt_ex == rhs.sqrt_ex && lhs.side_condition == rhs.side_condition;
+}
+}
+
+TEST(VS, ZeroCache)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Constraint<Poly> c1(Poly(x) * Poly(x) - Poly(y), Relation::LESS);
+	Constraint<Poly> c2(Poly(x) - Poly(y), Relation::EQ);
+
+	vs::ZeroCache<Poly> cache(2);
+	std::vector<vs::zero<Poly>> zeros;
+	EXPECT_TRUE(cache.gather(c1, x, zeros));
+	EXPECT_EQ(cache.hits(), 0);
+	EXPECT_EQ(cache.misses(), 1);
+	std::vector<vs::zero<Poly>> again;
+	EXPECT_TRUE(cache.gather(c1, x, again));
+	EXPECT_EQ(cache.hits(), 1);
+	EXPECT_EQ(cache.misses(), 1);
+	EXPECT_EQ(zeros, again);
+
+	// The elimination variable is part of the key.
+	cache.get(c1, y);
+	EXPECT_EQ(cache.misses(), 2);
+	EXPECT_EQ(cache.entries(), 2);
+	// The least recently used entry (c1, x) is evicted.
+	cache.get(c2, x);
+	cache.get(c1, y);
+	EXPECT_EQ(cache.hits(), 2);
+	cache.get(c1, x);
+	EXPECT_EQ(cache.misses(), 4);
+	EXPECT_EQ(cache.entries(), 2);
+
+	// A cubic factor is not supported, which is cached as well.
+	Constraint<Poly> cubic(Poly(x) * Poly(x) * Poly(x) - Poly(y), Relation::EQ);
+	std::vector<vs::zero<Poly>> none;
+	EXPECT_FALSE(cache.gather(cubic, x, none));
+	EXPECT_FALSE(cache.gather(cubic, x, none));
+	EXPECT_EQ(cache.hits(), 3);
+
+	cache.clear();
+	EXPECT_EQ(cache.entries(), 0);
+}
+
+TEST(VS, GatherAllZeros)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::vector<Constraint<Poly>> constraints = {
+		Constraint<Poly>(Poly(x) * Poly(x) - Poly(y), Relation::LESS),
+		Constraint<Poly>(Poly(x) - Poly(y), Relation::EQ),
+		Constraint<Poly>(Poly(x) * Poly(x) * Poly(x) - Poly(y), Relation::EQ),
+		Constraint<Poly>(Poly(y) - Rational(1), Relation::EQ),
+		Constraint<Poly>(Poly(x) * Poly(y) + Rational(1), Relation::GEQ)
+	};
+	std::vector<std::optional<std::vector<vs::zero<Poly>>>> single;
+	for (const auto& c: constraints) {
+		std::vector<vs::zero<Poly>> zeros;
+		if (vs::gather_zeros(c, x, zeros)) single.emplace_back(std::move(zeros));
+		else single.emplace_back(std::nullopt);
+	}
+	EXPECT_FALSE(single[2]);
+	EXPECT_TRUE(single[3] && single[3]->empty());
+
+	for (bool parallel: {false, true}) {
+		EXPECT_EQ(vs::gather_all_zeros(constraints, x, parallel), single);
+	}
+
+	// The same zeros are gathered via the global cache, and every constraint is computed only once.
+	vs::ZeroCache<Poly> cache;
+	auto previous = vs::ZeroCache<Poly>::set_global(&cache);
+	for (bool parallel: {false, true}) {
+		EXPECT_EQ(vs::gather_all_zeros(constraints, x, parallel), single);
+	}
+	vs::ZeroCache<Poly>::set_global(previous);
+	// The constraint without x is answered without the cache.
+	EXPECT_EQ(cache.misses(), constraints.size() - 1);
+	EXPECT_EQ(cache.hits(), constraints.size() - 1);
+}
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include <carl-arith/groebner/GBProcedure.h>
+
+#include <carl-arith/groebner/Ideal.h>
+#include <carl-arith/groebner/groebner.h>
+#include <carl-common/meta/platform.h>
+
+#include "../Common.h"
+
+
+using namespace carl;
+
+template<typename Coeff>
+using PolynomialWithReasonSet = MultivariatePolynomial<Coeff, GrLexOrdering, StdMultivariatePolynomialPolicies<BVReasons, NoAllocator>>;
+
+TEST(GB_Signature, T1)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+	MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	MultivariatePolynomial<Rational> F1({(Rational)1*x*x} );
+	MultivariatePolynomial<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x} );
+	MultivariatePolynomial<Rational> F3({(Rational)1*x*y} );
+	GBProcedure<MultivariatePolynomial<Rational>, SignatureBuchberger, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	ASSERT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+}
+
+TEST(GB_Signature, T1_ReasonSets)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	PolynomialWithReasonSet<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+	f1.setReasons(BitVector(0));
+	PolynomialWithReasonSet<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	f2.setReasons(BitVector(1));
+	GBProcedure<PolynomialWithReasonSet<Rational>, SignatureBuchberger, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	ASSERT_EQ(3, gbobject.getIdeal().nrGenerators());
+	for (const auto& p: gbobject.getBasisPolynomials()) {
+		EXPECT_TRUE(p.getReasons().getBit(0));
+		EXPECT_TRUE(p.getReasons().getBit(1));
+	}
+}
+
+TEST(GB_Signature, Cyclic4)
+{
+	Variable a = fresh_real_variable("a");
+	Variable b = fresh_real_variable("b");
+	Variable c = fresh_real_variable("c");
+	Variable d = fresh_real_variable("d");
+	using Poly = MultivariatePolynomial<Rational>;
+	std::vector<Poly> input = {
+		Poly({Term<Rational>(a), Term<Rational>(b), Term<Rational>(c), Term<Rational>(d)}),
+		Poly({Rational(1)*a*b, Rational(1)*b*c, Rational(1)*c*d, Rational(1)*d*a}),
+		Poly({Rational(1)*a*b*c, Rational(1)*b*c*d, Rational(1)*c*d*a, Rational(1)*d*a*b}),
+		Poly({Rational(1)*a*b*c*d, Term<Rational>(Rational(-1))}),
+	};
+
+	GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+	GBProcedure<Poly, SignatureBuchberger, StdAdding> signature;
+	for (const auto& p: input) {
+		buchberger.addPolynomial(p);
+		signature.addPolynomial(p);
+	}
+	buchberger.calculate();
+	unsigned avoided = BuchbergerStats::getInstance()->getNrAvoidedReductions();
+	signature.calculate();
+	EXPECT_LT(avoided, BuchbergerStats::getInstance()->getNrAvoidedReductions());
+	EXPECT_EQ(buchberger.getBasisPolynomials(), signature.getBasisPolynomials());
+}
+
+TEST(GB_Signature, Incremental)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	using Poly = MultivariatePolynomial<Rational>;
+
+	GBProcedure<Poly, SignatureBuchberger, StdAdding> gbobject;
+	gbobject.addPolynomial(Poly({Rational(1)*x*x, Rational(-1)*y}));
+	gbobject.calculate();
+	EXPECT_EQ(1, gbobject.getIdeal().nrGenerators());
+	gbobject.addPolynomial(Poly({Rational(1)*x*y, Term<Rational>(Rational(-1))}));
+	gbobject.calculate();
+	EXPECT_FALSE(gbobject.basisis_constant());
+	gbobject.addPolynomial(Poly({Term<Rational>(x), Term<Rational>(y)}));
+	gbobject.calculate();
+	EXPECT_TRUE(gbobject.basisis_constant());
+}
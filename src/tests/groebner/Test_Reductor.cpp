@@ -50,3 +50,29 @@ TEST(Reductor, Reduction)
     fres = reductor4.fullReduce();
     EXPECT_EQ((Rational)-1 * z, fres);
 }
+
+TEST(Reductor, GeobucketReduction)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	using Poly = MultivariatePolynomial<Rational>;
+	Ideal<Poly> ideal;
+	ideal.addGenerator(Poly({Rational(1)*x*x, Term<Rational>(z)}));
+	ideal.addGenerator(Poly({Rational(1)*y*y, Rational(-2)*x*z}));
+	ideal.addGenerator(Poly({Rational(1)*x*y*z, Rational(3)*y, Term<Rational>(Rational(-1))}));
+
+	std::vector<Poly> inputs = {
+		Poly(y),
+		Poly({Rational(1)*y*y}),
+		Poly({Rational(1)*x*x, Rational(1)*x*z}),
+		Poly({Rational(3)*x*x*y*y*z, Rational(-1)*x*x*x*y, Rational(5)*z*z, Term<Rational>(Rational(7))}),
+	};
+	for (const auto& f: inputs) {
+		Reductor<Poly, Poly> heap(ideal, f);
+		Reductor<Poly, Poly, GeobucketReduction> geobucket(ideal, f);
+		Poly expected = heap.fullReduce();
+		EXPECT_EQ(expected, geobucket.fullReduce());
+		EXPECT_EQ(heap.reductionOccured(), geobucket.reductionOccured());
+	}
+}
@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/core/Variables.h>
+#include <carl-arith/constraint/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/AdaptiveIntervalEvaluation.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(AdaptiveIntervalEvaluation, Double)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::map<Variable, Interval<Rational>> map;
+	map[x] = Interval<Rational>(1, 2);
+	map[y] = Interval<Rational>(Rational(1, 3), BoundType::WEAK, Rational(0), BoundType::INFTY);
+
+	using Poly = MultivariatePolynomial<Rational>;
+	Poly p = Poly(x) * Poly(y) + Rational(1);
+	AdaptivePrecision used;
+	EXPECT_TRUE(evaluate_adaptive(p, map, Relation::GREATER, AdaptiveEvaluationSettings(), &used));
+	EXPECT_EQ(used, AdaptivePrecision::DOUBLE);
+	EXPECT_FALSE(evaluate_adaptive(p, map, Relation::LEQ, AdaptiveEvaluationSettings(), &used));
+	EXPECT_EQ(used, AdaptivePrecision::DOUBLE);
+	EXPECT_EQ(sgn_adaptive(p, map), Sign::POSITIVE);
+	EXPECT_FALSE(sgn_adaptive(Poly(x) - Poly(y), map));
+
+	BasicConstraint<Poly> c(Poly(y) - Rational(1, 4), Relation::GREATER);
+	EXPECT_TRUE(evaluate_adaptive(c, map));
+}
+
+TEST(AdaptiveIntervalEvaluation, Refinement)
+{
+	Variable x = fresh_real_variable("x");
+	std::map<Variable, Interval<Rational>> map;
+	// Neither 1/3 nor 1/3 + 1/10^30 is representable as a double and both round to the same enclosure.
+	Rational third = Rational(1, 3);
+	Rational eps = Rational(1) / carl::pow(Rational(10), 30);
+	map[x] = Interval<Rational>(Rational(third + eps));
+
+	using Poly = MultivariatePolynomial<Rational>;
+	Poly p = Poly(x) - third;
+	AdaptivePrecision used;
+	EXPECT_EQ(sgn_adaptive(p, map, AdaptiveEvaluationSettings(), &used), Sign::POSITIVE);
+	EXPECT_EQ(used, AdaptivePrecision::MULTIPRECISION);
+
+	AdaptiveEvaluationSettings settings;
+	settings.max_precision = 64;
+	settings.exact_fallback = false;
+	EXPECT_TRUE(boost::indeterminate(evaluate_adaptive(p, map, Relation::GREATER, settings, &used)));
+	EXPECT_EQ(used, AdaptivePrecision::NONE);
+
+	// A zero that is only detected exactly.
+	map[x] = Interval<Rational>(third);
+	EXPECT_EQ(sgn_adaptive(p, map, AdaptiveEvaluationSettings(), &used), Sign::ZERO);
+	EXPECT_EQ(used, AdaptivePrecision::EXACT);
+}
+
+TEST(AdaptiveIntervalEvaluation, MultiprecisionBounds)
+{
+	Variable x = fresh_real_variable("x");
+	std::map<Variable, Interval<Rational>> map;
+	Rational third = Rational(1, 3);
+	Rational eps = Rational(1) / carl::pow(Rational(10), 30);
+
+	using Poly = MultivariatePolynomial<Rational>;
+	Poly p = Poly(x) * Poly(x) - third * third;
+	AdaptivePrecision used;
+
+	// Unbounded intervals and even powers of negative bounds.
+	map[x] = Interval<Rational>(Rational(third + eps), BoundType::WEAK, Rational(0), BoundType::INFTY);
+	EXPECT_EQ(sgn_adaptive(p, map, AdaptiveEvaluationSettings(), &used), Sign::POSITIVE);
+	EXPECT_EQ(used, AdaptivePrecision::MULTIPRECISION);
+	map[x] = Interval<Rational>(Rational(0), BoundType::INFTY, Rational(-third - eps), BoundType::WEAK);
+	EXPECT_EQ(sgn_adaptive(p, map, AdaptiveEvaluationSettings(), &used), Sign::POSITIVE);
+	EXPECT_EQ(used, AdaptivePrecision::MULTIPRECISION);
+	map[x] = Interval<Rational>(Rational(-third + eps), Rational(third - eps));
+	EXPECT_EQ(sgn_adaptive(p, map, AdaptiveEvaluationSettings(), &used), Sign::NEGATIVE);
+	EXPECT_EQ(used, AdaptivePrecision::MULTIPRECISION);
+	EXPECT_FALSE(sgn_adaptive(Poly(x) * p, map));
+}
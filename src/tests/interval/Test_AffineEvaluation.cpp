@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBox.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/poly/umvpoly/functions/AffineEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/Evaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(AffineEvaluation, Dependency)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	IntervalBox box(std::vector<Variable>({x, y}));
+	box.set(y, Interval<double>(-1, 1));
+
+	// x^2 - x has range [-1/4, 0] on [0, 1], interval arithmetic yields [0, 1] - [0, 1].
+	box.set(x, Interval<double>(0, 1));
+	AffineEvaluator p(Poly(x) * Poly(x) - Poly(x));
+	EXPECT_EQ(carl::evaluate(Poly(x) * Poly(x) - Poly(x), box), Interval<double>(-1, 1));
+	EXPECT_EQ(p.evaluate(box), Interval<double>(-0.5, 0.0));
+
+	// x^2 - 2x has range [-1, 3] on [1, 3], interval arithmetic yields [-5, 7].
+	box.set(x, Interval<double>(1, 3));
+	AffineEvaluator q(Poly(x) * Poly(x) - Rational(2) * Poly(x));
+	EXPECT_EQ(carl::evaluate(Poly(x) * Poly(x) - Rational(2) * Poly(x), box), Interval<double>(-5, 7));
+	EXPECT_EQ(q.evaluate(box), Interval<double>(-3, 3));
+
+	AffineEvaluator r(Poly(x) * Poly(y) - Poly(y));
+	EXPECT_EQ(r.variables().size(), 2);
+}
+
+TEST(AffineEvaluation, Enclosure)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	// x^2 - 2xy + y^2 + x*z / 3
+	Poly p = Poly(x) * Poly(x) - Rational(2) * Poly(x) * Poly(y) + Poly(y) * Poly(y) + Poly(x) * Poly(z) * Rational(1, 3);
+	AffineEvaluator eval(p);
+
+	// Ranges from a small box to a big one, over the same compiled polynomial.
+	for (double r: {0.01, 0.1, 1.0}) {
+		IntervalBox box(std::vector<Variable>({z, y, x}));
+		box.set(x, Interval<double>(2 - r, 2 + r));
+		box.set(y, Interval<double>(1 - r, 1 + r));
+		box.set(z, Interval<double>(-r, r));
+		Interval<double> natural = carl::evaluate(p, box);
+		Interval<double> affine = eval.evaluate(box);
+		EXPECT_TRUE(natural.contains(affine));
+		EXPECT_LT(affine.diameter(), natural.diameter());
+		for (double dx: {-r, 0.0, r}) {
+			for (double dy: {-r, 0.0, r}) {
+				for (double dz: {-r, 0.0, r}) {
+					std::map<Variable, Rational> point = {
+						{x, carl::rationalize<Rational>(2 + dx)}, {y, carl::rationalize<Rational>(1 + dy)}, {z, carl::rationalize<Rational>(dz)}
+					};
+					EXPECT_TRUE(affine.contains(carl::to_double(carl::evaluate(p, point))));
+				}
+			}
+		}
+	}
+}
+
+TEST(AffineEvaluation, Unbounded)
+{
+	Variable x = fresh_real_variable("x");
+	IntervalBox box;
+	box.set(x, Interval<double>(1, BoundType::WEAK, 0, BoundType::INFTY));
+	Poly p = Poly(x) * Poly(x) + Rational(1);
+	AffineEvaluator eval(p);
+	EXPECT_EQ(eval.evaluate(box), carl::evaluate(p, box));
+	EXPECT_EQ(eval.evaluate(box), Interval<double>(2, BoundType::WEAK, 0, BoundType::INFTY));
+}
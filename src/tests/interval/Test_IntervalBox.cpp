@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBox.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/DensePolynomial.h>
+#include <carl-arith/intervalcontraction/Contractor.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(IntervalBox, Basic)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable i = fresh_integer_variable("i");
+	IntervalBox box;
+	box.set(x, Interval<double>(1, BoundType::STRICT, 4, BoundType::WEAK));
+	box.set(i, Interval<double>(0, BoundType::INFTY, 3, BoundType::WEAK));
+	EXPECT_EQ(box.size(), 2);
+	EXPECT_TRUE(box.has(x));
+	EXPECT_TRUE(box.has(i));
+	EXPECT_FALSE(box.has(y));
+	EXPECT_EQ(box.position(y), IntervalBox::npos);
+	EXPECT_EQ(box.interval(x), Interval<double>(1, BoundType::STRICT, 4, BoundType::WEAK));
+	EXPECT_EQ(box.interval(i), Interval<double>(0, BoundType::INFTY, 3, BoundType::WEAK));
+	EXPECT_EQ(box.width(box.position(x)), 3);
+	EXPECT_EQ(box.widest(), box.position(i));
+	EXPECT_EQ(box.midpoint(box.position(x)), 2.5);
+	EXPECT_EQ(box.midpoint(box.position(i)), 2);
+	EXPECT_FALSE(box.is_empty());
+
+	std::map<Variable, Interval<double>> map = box.to_map();
+	EXPECT_EQ(map.size(), 2);
+	EXPECT_EQ(IntervalBox(map), box);
+
+	box.set(y, Interval<double>::empty_interval());
+	EXPECT_TRUE(box.is_empty());
+}
+
+TEST(IntervalBox, Intersection)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	IntervalBox a(std::vector<Variable>({x, y}));
+	a.set(x, Interval<double>(0, BoundType::WEAK, 2, BoundType::STRICT));
+	a.set(y, Interval<double>(0, 1));
+	IntervalBox b(std::vector<Variable>({x, y}));
+	b.set(x, Interval<double>(0, BoundType::STRICT, 2, BoundType::WEAK));
+	b.set(y, Interval<double>(2, 3));
+	// Same layout
+	IntervalBox c = set_intersection(a, b);
+	EXPECT_EQ(c.interval(x), Interval<double>(0, BoundType::STRICT, 2, BoundType::STRICT));
+	EXPECT_TRUE(c.interval(y).is_empty());
+	EXPECT_TRUE(c.is_empty());
+	// Different layouts yield the same result, missing variables are unbounded.
+	IntervalBox d(std::vector<Variable>({z, y, x}));
+	d.intersect_assign(b);
+	EXPECT_EQ(set_intersection(d, a), c.intersect_assign(IntervalBox(std::vector<Variable>({z}))));
+	EXPECT_EQ(d.interval(z), Interval<double>::unbounded_interval());
+}
+
+TEST(IntervalBox, Split)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	IntervalBox box(std::vector<Variable>({x, y}));
+	box.set(x, Interval<double>(0, 4));
+	box.set(y, Interval<double>(0, 1));
+	auto [lower, upper] = box.split(box.widest());
+	auto expected = Interval<double>(0, 4).split();
+	EXPECT_EQ(lower.interval(x), expected.first);
+	EXPECT_EQ(upper.interval(x), expected.second);
+	EXPECT_EQ(lower.interval(y), Interval<double>(0, 1));
+	EXPECT_EQ(upper.interval(y), Interval<double>(0, 1));
+}
+
+TEST(IntervalBox, Evaluation)
+{
+	Variable a = fresh_real_variable("a");
+	Variable b = fresh_real_variable("b");
+	Variable c = fresh_real_variable("c");
+	Interval<double>::evalintervalmap map;
+	map[a] = Interval<double>(1, 4);
+	map[b] = Interval<double>(2, 5);
+	map[c] = Interval<double>(-2, 3);
+	IntervalBox box(map);
+
+	using Poly = MultivariatePolynomial<Rational>;
+	Poly p = Rational(12) * Poly(a) * Poly(b) - Poly(c) * Poly(c) * Poly(c) + Rational(3);
+	EXPECT_EQ(carl::evaluate(p, box), carl::evaluate(p, map));
+
+	using Contractor = contractor::Contractor<int, Poly>;
+	BasicConstraint<Poly> cons(Poly(a) * Poly(c) - Poly(b), Relation::LEQ);
+	for (Variable v: {a, b, c}) {
+		Contractor contractor(0, cons, v);
+		EXPECT_EQ(contractor.evaluate(box), contractor.evaluate(map));
+		EXPECT_EQ(contractor.contract(box), contractor.contract(map));
+	}
+}
+
+TEST(IntervalBox, DensePolynomial)
+{
+	Variable a = fresh_real_variable("a");
+	Variable b = fresh_real_variable("b");
+	using Poly = MultivariatePolynomial<Rational>;
+	Poly p = Rational(1, 3) * Poly(a) * Poly(b) * Poly(b) - Poly(a) * Poly(a) + Rational(7);
+	DensePolynomial dense(p);
+	EXPECT_EQ(dense.variables().size(), 2);
+
+	// The same compiled polynomial over boxes with different layouts.
+	IntervalBox box1(std::vector<Variable>({a, b}));
+	IntervalBox box2(std::vector<Variable>({b, fresh_real_variable("c"), a}));
+	for (auto* box: {&box1, &box2}) {
+		box->set(a, Interval<double>(-1, 2));
+		box->set(b, Interval<double>(0.5, 3.0));
+		EXPECT_EQ(dense.evaluate(*box), carl::evaluate(p, *box));
+		EXPECT_EQ(dense.evaluate(*box, dense.positions(*box)), carl::evaluate(p, *box));
+	}
+}
+
+TEST(IntervalBox, EvaluationRoundsCoefficients)
+{
+	Variable a = fresh_real_variable("a");
+	IntervalBox box;
+	box.set(a, Interval<double>(3));
+
+	using Poly = MultivariatePolynomial<Rational>;
+	auto encloses = [](const Interval<double>& i, const Rational& r) {
+		return carl::rationalize<Rational>(i.lower()) <= r && r <= carl::rationalize<Rational>(i.upper());
+	};
+	// Neither 1/3 nor 10/3 is representable as a double.
+	EXPECT_TRUE(encloses(carl::evaluate(Poly(Rational(1, 3)), box), Rational(1, 3)));
+	Poly p = Rational(1, 3) * Poly(a) * Poly(a) + Rational(1, 3);
+	EXPECT_TRUE(encloses(carl::evaluate(p, box), Rational(10, 3)));
+	Poly q = Rational(-1, 3) * Poly(a);
+	EXPECT_TRUE(encloses(carl::evaluate(q, box), Rational(-1)));
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/intervalcontraction/Propagation.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using Constraint = BasicConstraint<Poly>;
+
+TEST(Propagation, Fixpoint)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	for (bool parallel: {false, true}) {
+		contractor::PropagationSettings settings;
+		settings.parallel = parallel;
+		settings.min_relative_contraction = 0.001;
+		contractor::Propagation<int, Poly> icp(settings);
+		// x + y = 10 and x - y = 2 have the unique solution x = 6, y = 4
+		icp.add(1, Constraint(Poly(x) + Poly(y) - Rational(10), Relation::EQ));
+		icp.add(2, Constraint(Poly(x) - Poly(y) - Rational(2), Relation::EQ));
+		icp.set_interval(x, Interval<double>(0, 100));
+		icp.set_interval(y, Interval<double>(0, 100));
+		EXPECT_EQ(icp.propagate(), contractor::PropagationStatus::FIXPOINT);
+		EXPECT_GT(icp.contractions(), 0);
+		// Hull consistency does not isolate the solution, but stalls at this box.
+		EXPECT_EQ(icp.interval(x), Interval<double>(2, 10));
+		EXPECT_EQ(icp.interval(y), Interval<double>(0, 8));
+		// Nothing changed, hence nothing is reactivated.
+		EXPECT_EQ(icp.propagate(), contractor::PropagationStatus::FIXPOINT);
+		EXPECT_EQ(icp.contractions(), 0);
+	}
+}
+
+TEST(Propagation, Reactivation)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	contractor::Propagation<int, Poly> icp;
+	// y = x^2, z = 2y
+	icp.add(1, Constraint(Poly(y) - Poly(x) * Poly(x), Relation::EQ));
+	icp.add(2, Constraint(Poly(z) - Rational(2) * Poly(y), Relation::EQ));
+	EXPECT_EQ(icp.propagate(), contractor::PropagationStatus::FIXPOINT);
+	EXPECT_EQ(icp.variables().size(), 3);
+	// y >= 0 is derived from y = x^2 alone.
+	EXPECT_EQ(icp.interval(y).lower(), 0);
+	EXPECT_EQ(icp.interval(z).lower(), 0);
+
+	icp.set_interval(x, Interval<double>(1, 2));
+	EXPECT_EQ(icp.propagate(), contractor::PropagationStatus::FIXPOINT);
+	EXPECT_EQ(icp.interval(y), Interval<double>(1, 4));
+	EXPECT_EQ(icp.interval(z), Interval<double>(2, 8));
+	EXPECT_EQ(icp.assignment().at(z), Interval<double>(2, 8));
+	EXPECT_EQ(icp.box().interval(z), Interval<double>(2, 8));
+}
+
+TEST(Propagation, Conflict)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable i = fresh_integer_variable("i");
+	contractor::Propagation<int, Poly> icp;
+	icp.add(1, Constraint(Poly(x) * Poly(x) + Poly(y) * Poly(y) - Rational(1), Relation::LEQ));
+	icp.add(2, Constraint(Poly(i) - Poly(x) * Rational(2), Relation::EQ));
+	icp.set_interval(i, Interval<double>(-10, 10));
+	EXPECT_EQ(icp.propagate(), contractor::PropagationStatus::FIXPOINT);
+	// The integer variable is rounded to integral bounds.
+	EXPECT_EQ(icp.interval(i), Interval<double>(-2, 2));
+
+	icp.add(3, Constraint(Poly(x) - Rational(2), Relation::GEQ));
+	EXPECT_EQ(icp.propagate(), contractor::PropagationStatus::CONFLICT);
+	ASSERT_TRUE(icp.conflict());
+	EXPECT_EQ(*icp.conflict(), 3);
+	EXPECT_EQ(icp.propagate(), contractor::PropagationStatus::CONFLICT);
+}
@@ -0,0 +1,288 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-arith/groebner/groebner.h>
+#include <carl-arith/numbers/numbers.h>
+
+#include <gmp.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+/**
+ * Groebner basis benchmarks on the classical families Cyclic-n, Katsura-n and Eco-n and on random ideals.
+ *
+ * Besides the running time, every benchmark reports the size of the basis as a counter.
+ * Procedures that record BuchbergerStats additionally report the number of (zero) reductions.
+ * The counter peak_bytes is the peak of the memory allocated by operator new and GMP while the benchmark runs.
+ * The target benchmark-groebner runs this suite and writes the results as JSON for comparisons between releases.
+ */
+
+using Rat = mpq_class;
+using Poly = carl::MultivariatePolynomial<Rat>;
+
+namespace {
+
+std::atomic<long long> allocated_bytes{0};
+std::atomic<long long> peak_allocated_bytes{0};
+
+void count_allocation(std::size_t size) {
+	long long cur = allocated_bytes += static_cast<long long>(size);
+	long long peak = peak_allocated_bytes.load();
+	while (cur > peak && !peak_allocated_bytes.compare_exchange_weak(peak, cur)) {}
+}
+void count_deallocation(std::size_t size) {
+	allocated_bytes -= static_cast<long long>(size);
+}
+
+void* gmp_allocate(std::size_t size) {
+	void* res = std::malloc(size);
+	if (res == nullptr) std::abort();
+	count_allocation(size);
+	return res;
+}
+void* gmp_reallocate(void* ptr, std::size_t old_size, std::size_t new_size) {
+	void* res = std::realloc(ptr, new_size);
+	if (res == nullptr) std::abort();
+	count_deallocation(old_size);
+	count_allocation(new_size);
+	return res;
+}
+void gmp_free(void* ptr, std::size_t size) {
+	count_deallocation(size);
+	std::free(ptr);
+}
+
+/**
+ * Starts a new measurement of the peak memory.
+ * Returns the memory that is currently allocated, which is the baseline of the measurement.
+ */
+long long reset_peak_memory() {
+	static bool gmp_counted = []() {
+		mp_set_memory_functions(&gmp_allocate, &gmp_reallocate, &gmp_free);
+		return true;
+	}();
+	(void)gmp_counted;
+	long long cur = allocated_bytes.load();
+	peak_allocated_bytes = cur;
+	return cur;
+}
+
+std::vector<carl::Variable> make_variables(std::size_t n) {
+	std::vector<carl::Variable> res;
+	for (std::size_t i = 0; i < n; ++i) {
+		res.emplace_back(carl::fresh_real_variable("x" + std::to_string(i)));
+	}
+	return res;
+}
+
+/// Cyclic-n: sum_i prod_{j<k} x_{i+j} for k = 1..n-1 and x_0 * ... * x_{n-1} - 1.
+std::vector<Poly> cyclic(std::size_t n) {
+	auto x = make_variables(n);
+	std::vector<Poly> res;
+	for (std::size_t k = 1; k < n; ++k) {
+		Poly p;
+		for (std::size_t i = 0; i < n; ++i) {
+			Poly t(Rat(1));
+			for (std::size_t j = 0; j < k; ++j) t *= x[(i + j) % n];
+			p += t;
+		}
+		res.emplace_back(p);
+	}
+	Poly prod(Rat(1));
+	for (const auto& v: x) prod *= v;
+	res.emplace_back(prod - Rat(1));
+	return res;
+}
+
+/// Katsura-n: u_0 + 2 * sum_{i>0} u_i - 1 and sum_l u_|l| * u_|m-l| - u_m for m = 0..n-1.
+std::vector<Poly> katsura(std::size_t n) {
+	auto u = make_variables(n + 1);
+	auto var = [&u,n](long i) {
+		std::size_t a = std::size_t(std::abs(i));
+		return a <= n ? Poly(u[a]) : Poly();
+	};
+	std::vector<Poly> res;
+	Poly lin = Poly(u[0]) - Rat(1);
+	for (std::size_t i = 1; i <= n; ++i) lin += Rat(2) * u[i];
+	res.emplace_back(lin);
+	for (long m = 0; m < long(n); ++m) {
+		Poly p = -var(m);
+		for (long l = -long(n); l <= long(n); ++l) {
+			p += var(l) * var(m - l);
+		}
+		res.emplace_back(p);
+	}
+	return res;
+}
+
+/// Eco-n: (x_k + sum_i x_i * x_{i+k}) * x_n - k for k = 1..n-2 and x_{n-1} * x_n - (n-1), sum_i x_i + 1.
+std::vector<Poly> eco(std::size_t n) {
+	auto x = make_variables(n);
+	std::vector<Poly> res;
+	for (std::size_t k = 1; k + 1 < n; ++k) {
+		Poly p(x[k - 1]);
+		for (std::size_t i = 1; i + k < n; ++i) {
+			p += Poly(x[i - 1]) * x[i + k - 1];
+		}
+		res.emplace_back(p * x[n - 1] - Rat(k));
+	}
+	res.emplace_back(Poly(x[n - 2]) * x[n - 1] - Rat(n - 1));
+	Poly sum(Rat(1));
+	for (std::size_t i = 0; i + 1 < n; ++i) sum += x[i];
+	res.emplace_back(sum);
+	return res;
+}
+
+/**
+ * Random ideal in n variables with n generators of the given degree.
+ * Every monomial of degree at most degree is used with probability density / 100.
+ */
+std::vector<Poly> random_ideal(std::size_t n, std::size_t degree, int density, unsigned seed) {
+	auto x = make_variables(n);
+	std::mt19937 rand(seed);
+	std::uniform_int_distribution<int> coeff(-9, 9);
+	std::uniform_int_distribution<int> percent(0, 99);
+	// All exponent vectors of total degree at most degree.
+	std::vector<std::vector<std::size_t>> exponents = {{}};
+	for (std::size_t i = 0; i < n; ++i) {
+		std::vector<std::vector<std::size_t>> next;
+		for (const auto& e: exponents) {
+			std::size_t sum = 0;
+			for (auto d: e) sum += d;
+			for (std::size_t d = 0; d + sum <= degree; ++d) {
+				next.push_back(e);
+				next.back().push_back(d);
+			}
+		}
+		exponents = std::move(next);
+	}
+	std::vector<Poly> res;
+	while (res.size() < n) {
+		Poly p;
+		for (const auto& e: exponents) {
+			if (percent(rand) >= density) continue;
+			carl::Term<Rat> t(Rat(coeff(rand)));
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t d = 0; d < e[i]; ++d) t = t * x[i];
+			}
+			p += t;
+		}
+		if (!carl::is_zero(p) && !p.is_constant()) res.emplace_back(p);
+	}
+	return res;
+}
+
+template<template<typename, template<typename> class> class Procedure>
+void run_groebner(benchmark::State& state, const std::vector<Poly>& ideal) {
+	auto* stats = carl::BuchbergerStats::getInstance();
+	std::size_t basis = 0;
+	unsigned reductions = stats->getNrReductions();
+	unsigned zero = stats->getNrZeroReductions();
+	long long memory = reset_peak_memory();
+	for (auto _ : state) {
+		carl::GBProcedure<Poly, Procedure, carl::StdAdding> gb;
+		for (const auto& p: ideal) gb.addPolynomial(p);
+		gb.calculate();
+		basis = gb.getIdeal().nrGenerators();
+		benchmark::DoNotOptimize(basis);
+	}
+	state.counters["basis"] = double(basis);
+	state.counters["peak_bytes"] = double(peak_allocated_bytes - memory);
+	if (stats->getNrReductions() != reductions) {
+		state.counters["reductions"] = benchmark::Counter(double(stats->getNrReductions() - reductions), benchmark::Counter::kAvgIterations);
+		state.counters["zero_reductions"] = benchmark::Counter(double(stats->getNrZeroReductions() - zero), benchmark::Counter::kAvgIterations);
+	}
+}
+
+/// Reduces products of the generators modulo the basis, which exercises the divisor lookup of Ideal.
+void run_reduction(benchmark::State& state, const std::vector<Poly>& ideal) {
+	carl::GBProcedure<Poly, carl::Buchberger, carl::StdAdding> gb;
+	for (const auto& p: ideal) gb.addPolynomial(p);
+	gb.calculate();
+	const auto& basis = gb.getIdeal();
+	std::vector<Poly> products;
+	for (const auto& p: ideal) {
+		for (const auto& q: ideal) products.emplace_back(p * q + q);
+	}
+	long long memory = reset_peak_memory();
+	for (auto _ : state) {
+		for (const auto& p: products) {
+			carl::Reductor<Poly, Poly> reductor(basis, p);
+			benchmark::DoNotOptimize(reductor.fullReduce());
+		}
+	}
+	state.counters["basis"] = double(basis.nrGenerators());
+	state.counters["peak_bytes"] = double(peak_allocated_bytes - memory);
+}
+
+}
+
+// Stores the size in front of every allocation for count_deallocation().
+// The array and nothrow variants forward to these by default.
+constexpr std::size_t allocation_header = alignof(std::max_align_t);
+
+void* operator new(std::size_t size) {
+	void* res = std::malloc(size + allocation_header);
+	if (res == nullptr) throw std::bad_alloc();
+	*static_cast<std::size_t*>(res) = size;
+	count_allocation(size);
+	return static_cast<char*>(res) + allocation_header;
+}
+
+void operator delete(void* ptr) noexcept {
+	if (ptr == nullptr) return;
+	void* block = static_cast<char*>(ptr) - allocation_header;
+	count_deallocation(*static_cast<std::size_t*>(block));
+	std::free(block);
+}
+
+static void GB_Cyclic(benchmark::State& state) {
+	run_groebner<carl::Buchberger>(state, cyclic(std::size_t(state.range(0))));
+}
+BENCHMARK(GB_Cyclic)->DenseRange(3, 5)->Unit(benchmark::kMillisecond);
+
+static void GB_Cyclic_Signature(benchmark::State& state) {
+	run_groebner<carl::SignatureBuchberger>(state, cyclic(std::size_t(state.range(0))));
+}
+BENCHMARK(GB_Cyclic_Signature)->DenseRange(3, 5)->Unit(benchmark::kMillisecond);
+
+static void GB_Katsura(benchmark::State& state) {
+	run_groebner<carl::Buchberger>(state, katsura(std::size_t(state.range(0))));
+}
+BENCHMARK(GB_Katsura)->DenseRange(2, 4)->Unit(benchmark::kMillisecond);
+
+static void GB_Katsura_Signature(benchmark::State& state) {
+	run_groebner<carl::SignatureBuchberger>(state, katsura(std::size_t(state.range(0))));
+}
+BENCHMARK(GB_Katsura_Signature)->DenseRange(2, 4)->Unit(benchmark::kMillisecond);
+
+static void GB_Eco(benchmark::State& state) {
+	run_groebner<carl::Buchberger>(state, eco(std::size_t(state.range(0))));
+}
+BENCHMARK(GB_Eco)->DenseRange(3, 5)->Unit(benchmark::kMillisecond);
+
+static void GB_Eco_Signature(benchmark::State& state) {
+	run_groebner<carl::SignatureBuchberger>(state, eco(std::size_t(state.range(0))));
+}
+BENCHMARK(GB_Eco_Signature)->DenseRange(3, 5)->Unit(benchmark::kMillisecond);
+
+static void GB_RandomDense(benchmark::State& state) {
+	run_groebner<carl::Buchberger>(state, random_ideal(3, std::size_t(state.range(0)), 80, 42));
+}
+BENCHMARK(GB_RandomDense)->DenseRange(2, 3)->Unit(benchmark::kMillisecond);
+
+static void GB_RandomSparse(benchmark::State& state) {
+	run_groebner<carl::Buchberger>(state, random_ideal(3, std::size_t(state.range(0)), 20, 42));
+}
+BENCHMARK(GB_RandomSparse)->DenseRange(2, 3)->Unit(benchmark::kMillisecond);
+
+static void GB_Reduction_Katsura(benchmark::State& state) {
+	run_reduction(state, katsura(std::size_t(state.range(0))));
+}
+BENCHMARK(GB_Reduction_Katsura)->DenseRange(2, 3)->Unit(benchmark::kMicrosecond);
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	::operator delete(ptr);
+}
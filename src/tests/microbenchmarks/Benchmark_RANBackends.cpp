@@ -0,0 +1,341 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-common/config.h>
+#include <carl-arith/ran/ran.h>
+#include <carl-arith/ran/real_roots.h>
+#include <carl-arith/poly/umvpoly/functions/Derivative.h>
+#ifdef USE_LIBPOLY
+#include <carl-arith/poly/lp/LPContext.h>
+#include <carl-arith/poly/lp/LPPolynomial.h>
+#endif
+
+#include "PolynomialFamilies.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+/*
+ * Differential benchmarks for the backends of real algebraic numbers.
+ *
+ * Every operation (root isolation, comparison, sign evaluation, lifting and evaluation at sample points) is run by the interval
+ * backend with every root isolation strategy and by libpoly, if available. Before the timing starts, the results are checked
+ * against the interval backend with bisection, a mismatch is reported as error of the benchmark.
+ * All numbers are converted to interval representations for this check, hence different backends are compared exactly.
+ * Lifting and evaluation at sample points need CoCoALib. The thom backend is not covered, as it is currently disabled in ran.h.
+ *
+ * Run with --benchmark_filter=^RB_ or use the benchmark-ran target that writes the timings as JSON.
+ */
+
+namespace {
+
+using namespace families;
+using Strategy = carl::ran::RootIsolationStrategy;
+using IntervalRAN = carl::RealAlgebraicNumberInterval<mpq_class>;
+
+carl::Interval<mpq_class> unbounded() {
+	return carl::Interval<mpq_class>::unbounded_interval();
+}
+
+/// Interval backend with a fixed root isolation strategy.
+class IntervalBackend {
+	Strategy mStrategy;
+public:
+	using RAN = IntervalRAN;
+	using Univariate = Poly;
+	using Multivariate = MPoly;
+
+	explicit IntervalBackend(Strategy strategy): mStrategy(strategy) {}
+
+	Univariate univariate(const Poly& p) const {
+		return p;
+	}
+	Multivariate multivariate(const CADInstance&, const MPoly& p) const {
+		return p;
+	}
+	/// Creates a number that does not share its refinements with r.
+	RAN create(const IntervalRAN& r) const {
+		if (r.is_numeric()) return RAN(r.value());
+		return RAN(r.polynomial(), r.interval());
+	}
+	IntervalRAN reference(const RAN& r) const {
+		return r;
+	}
+
+	std::vector<RAN> isolate(const Univariate& p) const {
+		return carl::real_roots(p, unbounded(), mStrategy).roots();
+	}
+	std::vector<RAN> lift(const CADInstance& cad, const Multivariate& p, const RAN& sample) const {
+		std::map<carl::Variable, RAN> assignment{{cad.x, sample}};
+		return carl::real_roots(carl::to_univariate_polynomial(p, cad.y), assignment, unbounded(), mStrategy).roots();
+	}
+	carl::Sign sgn(const RAN& r, const Poly& q) const {
+		return r.sgn(q);
+	}
+	carl::Sign evaluate(const CADInstance& cad, const Multivariate& q, const RAN& sx, const RAN& sy) const {
+		auto res = carl::evaluate(q, carl::Assignment<RAN>{{cad.x, sx}, {cad.y, sy}});
+		assert(res);
+		return res->sgn();
+	}
+};
+
+#ifdef USE_LIBPOLY
+/// Libpoly backend, polynomials are converted to libpoly before the timing starts.
+class LibpolyBackend {
+public:
+	using RAN = carl::LPRealAlgebraicNumber;
+	using Univariate = carl::LPPolynomial;
+	using Multivariate = carl::LPPolynomial;
+
+	Univariate univariate(const Poly& p) const {
+		auto integral = p.coprime_coefficients();
+		carl::LPContext context(std::vector<carl::Variable>{p.main_var()});
+		return carl::LPPolynomial(context, p.main_var(), integral.coefficients());
+	}
+	/// The sample variable x is the last one in the variable order, as it is assigned when lifting.
+	Multivariate multivariate(const CADInstance& cad, const MPoly& p) const {
+		carl::LPContext context(std::vector<carl::Variable>{cad.y, cad.x});
+		carl::LPPolynomial res(context);
+		for (const auto& term: p) {
+			assert(carl::is_integer(term.coeff()));
+			carl::LPPolynomial t(context, 1L);
+			t *= carl::get_num(term.coeff());
+			if (term.monomial()) {
+				for (const auto& [var, exp]: *term.monomial()) {
+					t *= carl::LPPolynomial(context, var, mpz_class(1), exp);
+				}
+			}
+			res += t;
+		}
+		return res;
+	}
+	RAN create(const IntervalRAN& r) const {
+		if (r.is_numeric()) return RAN(r.value());
+		return RAN(r.polynomial(), r.interval());
+	}
+	IntervalRAN reference(const RAN& r) const {
+		if (r.is_numeric()) return IntervalRAN(r.value());
+		return IntervalRAN::create_safe(r.polynomial(), r.interval());
+	}
+
+	std::vector<RAN> isolate(const Univariate& p) const {
+		return carl::real_roots(p).roots();
+	}
+	std::vector<RAN> lift(const CADInstance& cad, const Multivariate& p, const RAN& sample) const {
+		std::map<carl::Variable, RAN> assignment{{cad.x, sample}};
+		return carl::real_roots(p, assignment).roots();
+	}
+	carl::Sign sgn(const RAN& r, const Poly& q) const {
+		return r.sgn(q);
+	}
+	carl::Sign evaluate(const CADInstance& cad, const Multivariate& q, const RAN& sx, const RAN& sy) const {
+		auto res = carl::evaluate(q, std::map<carl::Variable, RAN>{{cad.x, sx}, {cad.y, sy}});
+		assert(res);
+		return res->sgn();
+	}
+};
+#endif
+
+/// The interval backend with bisection, all other backends are checked against it.
+const IntervalBackend reference_backend(Strategy::Bisection);
+
+template<typename Backend>
+std::vector<IntervalRAN> to_reference(const Backend& backend, const std::vector<typename Backend::RAN>& rans) {
+	std::vector<IntervalRAN> res;
+	for (const auto& r: rans) res.emplace_back(backend.reference(r));
+	return res;
+}
+
+template<typename Backend>
+std::vector<typename Backend::RAN> create_all(const Backend& backend, const std::vector<IntervalRAN>& rans) {
+	std::vector<typename Backend::RAN> res;
+	for (const auto& r: rans) res.emplace_back(backend.create(r));
+	return res;
+}
+
+/// Isolates the real roots of p.
+template<typename Backend>
+void run_isolate(benchmark::State& state, const Backend& backend, const Poly& p) {
+	auto expected = reference_backend.isolate(p);
+	auto bp = backend.univariate(p);
+	if (to_reference(backend, backend.isolate(bp)) != expected) {
+		state.SkipWithError("Isolated roots differ from the reference");
+		return;
+	}
+	for (auto _ : state) {
+		auto roots = backend.isolate(bp);
+		benchmark::DoNotOptimize(roots);
+	}
+	state.counters["roots"] = double(expected.size());
+}
+
+/// Sorts the real roots of p and of its derivative, which interlace for polynomials with only real roots.
+template<typename Backend>
+void run_compare(benchmark::State& state, const Backend& backend, const Poly& p) {
+	auto expected = reference_backend.isolate(p);
+	for (const auto& r: reference_backend.isolate(carl::derivative(p))) expected.emplace_back(r);
+	auto inputs = expected;
+	std::sort(expected.begin(), expected.end());
+	auto check = create_all(backend, inputs);
+	std::sort(check.begin(), check.end());
+	if (to_reference(backend, check) != expected) {
+		state.SkipWithError("Sorted roots differ from the reference");
+		return;
+	}
+	for (auto _ : state) {
+		// Numbers are created from scratch, as refinements from earlier comparisons would be reused otherwise.
+		auto rans = create_all(backend, inputs);
+		std::sort(rans.begin(), rans.end());
+		benchmark::DoNotOptimize(rans);
+	}
+	state.counters["numbers"] = double(inputs.size());
+}
+
+/// Evaluates the sign of the derivative of p at the real roots of p.
+template<typename Backend>
+void run_sign(benchmark::State& state, const Backend& backend, const Poly& p) {
+	auto roots = reference_backend.isolate(p);
+	Poly q = carl::derivative(p);
+	auto sign_all = [&q](const auto& b, const auto& rans) {
+		std::vector<carl::Sign> res;
+		for (const auto& r: rans) res.emplace_back(b.sgn(r, q));
+		return res;
+	};
+	auto expected = sign_all(reference_backend, create_all(reference_backend, roots));
+	if (sign_all(backend, create_all(backend, roots)) != expected) {
+		state.SkipWithError("Signs differ from the reference");
+		return;
+	}
+	for (auto _ : state) {
+		auto signs = sign_all(backend, create_all(backend, roots));
+		benchmark::DoNotOptimize(signs);
+	}
+	state.counters["numbers"] = double(roots.size());
+}
+
+/// Lifts over the real roots of the projection of a CAD instance, i.e. isolates the roots of p at every sample.
+template<typename Backend>
+void run_lift(benchmark::State& state, const Backend& backend, const CADInstance& cad) {
+	auto samples = reference_backend.isolate(cad.projection);
+	auto bp = backend.multivariate(cad, cad.p);
+	std::size_t cells = 0;
+	for (const auto& s: samples) {
+		auto expected = reference_backend.lift(cad, cad.p, reference_backend.create(s));
+		if (to_reference(backend, backend.lift(cad, bp, backend.create(s))) != expected) {
+			state.SkipWithError("Lifted roots differ from the reference");
+			return;
+		}
+		cells += expected.size();
+	}
+	for (auto _ : state) {
+		for (const auto& s: create_all(backend, samples)) {
+			auto roots = backend.lift(cad, bp, s);
+			benchmark::DoNotOptimize(roots);
+		}
+	}
+	state.counters["samples"] = double(samples.size());
+	state.counters["sections"] = double(cells);
+}
+
+/// Evaluates the sign of q at every sample point (x,y) of the sections of p over the real roots of the projection.
+template<typename Backend>
+void run_evaluate(benchmark::State& state, const Backend& backend, const CADInstance& cad) {
+	std::vector<std::pair<IntervalRAN, IntervalRAN>> points;
+	for (const auto& s: reference_backend.isolate(cad.projection)) {
+		for (const auto& r: reference_backend.lift(cad, cad.p, reference_backend.create(s))) {
+			points.emplace_back(s, r);
+		}
+	}
+	auto bq = backend.multivariate(cad, cad.q);
+	auto sign_all = [&cad, &points](const auto& b, const auto& q) {
+		std::vector<carl::Sign> res;
+		for (const auto& [sx, sy]: points) res.emplace_back(b.evaluate(cad, q, b.create(sx), b.create(sy)));
+		return res;
+	};
+	if (sign_all(backend, bq) != sign_all(reference_backend, cad.q)) {
+		state.SkipWithError("Signs differ from the reference");
+		return;
+	}
+	for (auto _ : state) {
+		auto signs = sign_all(backend, bq);
+		benchmark::DoNotOptimize(signs);
+	}
+	state.counters["points"] = double(points.size());
+}
+
+struct Family {
+	std::string name;
+	Poly (*generator)(std::size_t);
+	std::vector<long> sizes;
+};
+
+const std::vector<Family>& univariate_families() {
+	static const std::vector<Family> families = {
+		{"Chebyshev", chebyshev, {10, 20}},
+		{"Wilkinson", wilkinson, {10, 20}},
+		{"Mignotte", mignotte, {10, 20}},
+		{"RandomSparse", random_sparse, {20, 40}},
+		{"CAD", [](std::size_t n){ return cad_projection(n).projection; }, {2, 3}},
+	};
+	return families;
+}
+
+/// Registers the benchmarks that isolate real roots, they are run for every root isolation strategy.
+template<typename Backend>
+void register_isolation(const std::string& name, const Backend& backend) {
+	for (const auto& f: univariate_families()) {
+		auto generator = f.generator;
+		auto* b = benchmark::RegisterBenchmark(("RB_Isolate_" + f.name + "_" + name).c_str(), [backend, generator](benchmark::State& state) {
+			run_isolate(state, backend, generator(std::size_t(state.range(0))));
+		});
+		for (long size: f.sizes) b->Arg(size);
+		b->Unit(benchmark::kMillisecond);
+	}
+#ifdef USE_COCOA
+	// The interval backend needs CoCoALib to compute with several algebraic numbers at once.
+	benchmark::RegisterBenchmark(("RB_Lift_CAD_" + name).c_str(), [backend](benchmark::State& state) {
+		run_lift(state, backend, cad_projection(std::size_t(state.range(0))));
+	})->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+#endif
+}
+
+/// Registers the benchmarks for operations on real algebraic numbers, which do not depend on the root isolation strategy.
+template<typename Backend>
+void register_operations(const std::string& name, const Backend& backend) {
+	for (const auto& f: univariate_families()) {
+		auto generator = f.generator;
+		auto* compare = benchmark::RegisterBenchmark(("RB_Compare_" + f.name + "_" + name).c_str(), [backend, generator](benchmark::State& state) {
+			run_compare(state, backend, generator(std::size_t(state.range(0))));
+		});
+		auto* sign = benchmark::RegisterBenchmark(("RB_Sign_" + f.name + "_" + name).c_str(), [backend, generator](benchmark::State& state) {
+			run_sign(state, backend, generator(std::size_t(state.range(0))));
+		});
+		for (auto* b: {compare, sign}) {
+			for (long size: f.sizes) b->Arg(size);
+			b->Unit(benchmark::kMillisecond);
+		}
+	}
+#ifdef USE_COCOA
+	benchmark::RegisterBenchmark(("RB_Evaluate_CAD_" + name).c_str(), [backend](benchmark::State& state) {
+		run_evaluate(state, backend, cad_projection(std::size_t(state.range(0))));
+	})->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+#endif
+}
+
+bool register_benchmarks() {
+	register_isolation("Bisection", IntervalBackend(Strategy::Bisection));
+	register_isolation("Descartes", IntervalBackend(Strategy::Descartes));
+	register_isolation("ContinuedFraction", IntervalBackend(Strategy::ContinuedFraction));
+	register_isolation("Approximation", IntervalBackend(Strategy::Approximation));
+	register_operations("Interval", reference_backend);
+#ifdef USE_LIBPOLY
+	register_isolation("Libpoly", LibpolyBackend());
+	register_operations("Libpoly", LibpolyBackend());
+#endif
+	return true;
+}
+
+[[maybe_unused]] const bool registered = register_benchmarks();
+
+}
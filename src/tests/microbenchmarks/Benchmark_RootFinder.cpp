@@ -3,6 +3,8 @@
 #include <carl-arith/ran/real_roots.h>
 //#include <carl-arith/ran/ran.h>
 
+#include "PolynomialFamilies.h"
+
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 
 class RF_Fixture: public benchmark::Fixture {	
@@ -46,3 +48,43 @@ BENCHMARK_F(RF_Fixture, Real_Roots_2)(benchmark::State& state) {
 
 
 
+namespace {
+
+using Strategy = carl::ran::RootIsolationStrategy;
+using namespace families;
+
+/**
+ * Isolates the roots of p with the given strategy.
+ * The result is checked against the default bisection once, before the timing starts.
+ */
+void run_isolation(benchmark::State& state, const Poly& p, Strategy strategy) {
+	auto interval = carl::Interval<mpq_class>::unbounded_interval();
+	auto expected = carl::real_roots(p, interval).roots();
+	auto roots = carl::real_roots(p, interval, strategy).roots();
+	if (roots != expected) {
+		state.SkipWithError("Isolated roots differ from bisection");
+		return;
+	}
+	for (auto _ : state) {
+		auto rans = carl::real_roots(p, interval, strategy);
+		benchmark::DoNotOptimize(rans);
+	}
+	state.counters["roots"] = double(roots.size());
+}
+
+}
+
+#define ROOT_ISOLATION_BENCHMARK(Name, Generator, Range) \
+	static void RI_##Name##_Bisection(benchmark::State& state) { run_isolation(state, Generator(std::size_t(state.range(0))), Strategy::Bisection); } \
+	BENCHMARK(RI_##Name##_Bisection)Range->Unit(benchmark::kMillisecond); \
+	static void RI_##Name##_Descartes(benchmark::State& state) { run_isolation(state, Generator(std::size_t(state.range(0))), Strategy::Descartes); } \
+	BENCHMARK(RI_##Name##_Descartes)Range->Unit(benchmark::kMillisecond); \
+	static void RI_##Name##_ContinuedFraction(benchmark::State& state) { run_isolation(state, Generator(std::size_t(state.range(0))), Strategy::ContinuedFraction); } \
+	BENCHMARK(RI_##Name##_ContinuedFraction)Range->Unit(benchmark::kMillisecond); \
+	static void RI_##Name##_Approximation(benchmark::State& state) { run_isolation(state, Generator(std::size_t(state.range(0))), Strategy::Approximation); } \
+	BENCHMARK(RI_##Name##_Approximation)Range->Unit(benchmark::kMillisecond);
+
+ROOT_ISOLATION_BENCHMARK(Chebyshev, chebyshev, ->Arg(20)->Arg(40)->Arg(60))
+ROOT_ISOLATION_BENCHMARK(Wilkinson, wilkinson, ->Arg(10)->Arg(20))
+ROOT_ISOLATION_BENCHMARK(Mignotte, mignotte, ->Arg(10)->Arg(20))
+ROOT_ISOLATION_BENCHMARK(RandomDense, random_dense, ->Arg(20)->Arg(40))
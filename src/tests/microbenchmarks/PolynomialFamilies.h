@@ -0,0 +1,120 @@
+#pragma once
+
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Chebyshev.h>
+#include <carl-arith/poly/umvpoly/functions/Resultant.h>
+#include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
+
+#include <cassert>
+#include <random>
+#include <vector>
+
+/**
+ * Families of polynomials that are used as inputs for the real root benchmarks.
+ * All generators are deterministic and produce polynomials with integer coefficients, unless stated otherwise.
+ */
+namespace families {
+
+using Poly = carl::UnivariatePolynomial<mpq_class>;
+using MPoly = carl::MultivariatePolynomial<mpq_class>;
+
+/// Chebyshev polynomial of the first kind: many real roots within [-1,1].
+inline Poly chebyshev(std::size_t n) {
+	carl::Chebyshev<mpq_class> cheb(carl::fresh_real_variable("x"));
+	return cheb(n);
+}
+
+/// Perturbed Wilkinson polynomial (x-1)*...*(x-n) + 1/1000: well separated, but ill-conditioned roots.
+inline Poly wilkinson(std::size_t n) {
+	carl::Variable x = carl::fresh_real_variable("x");
+	Poly p(x, mpq_class(1));
+	for (std::size_t i = 1; i <= n; ++i) {
+		p *= Poly(x, {mpq_class(-long(i)), mpq_class(1)});
+	}
+	return p + Poly(x, mpq_class(1, 1000));
+}
+
+/// Mignotte polynomial x^n - 2*(100*x - 1)^2: two roots that are very close to each other.
+inline Poly mignotte(std::size_t n) {
+	carl::Variable x = carl::fresh_real_variable("x");
+	Poly lin(x, {mpq_class(-1), mpq_class(100)});
+	std::vector<mpq_class> coeffs(n + 1, mpq_class(0));
+	coeffs[n] = 1;
+	return Poly(x, coeffs) - mpq_class(2) * lin * lin;
+}
+
+/// Dense random polynomial with integer coefficients in [-100,100].
+inline Poly random_dense(std::size_t n) {
+	carl::Variable x = carl::fresh_real_variable("x");
+	std::mt19937 rand(42);
+	std::uniform_int_distribution<int> coeff(-100, 100);
+	std::vector<mpq_class> coeffs;
+	for (std::size_t i = 0; i <= n; ++i) coeffs.emplace_back(coeff(rand));
+	if (carl::is_zero(coeffs.back())) coeffs.back() = 1;
+	return Poly(x, coeffs);
+}
+
+/// Random polynomial of degree n with nonzero constant coefficient and four further nonzero coefficients in [-2^20,2^20].
+inline Poly random_sparse(std::size_t n) {
+	carl::Variable x = carl::fresh_real_variable("x");
+	std::mt19937 rand(42);
+	std::uniform_int_distribution<long> coeff(-(1L << 20), 1L << 20);
+	std::uniform_int_distribution<std::size_t> exponent(1, n - 1);
+	std::vector<mpq_class> coeffs(n + 1, mpq_class(0));
+	auto nonzero = [&]() {
+		long c = 0;
+		while (c == 0) c = coeff(rand);
+		return mpq_class(c);
+	};
+	coeffs.front() = nonzero();
+	coeffs.back() = nonzero();
+	for (std::size_t i = 0; i < 3; ++i) coeffs[exponent(rand)] = nonzero();
+	return Poly(x, coeffs);
+}
+
+/**
+ * Two bivariate polynomials p and q in x and y and their projection res_y(p,q), as they appear in a cylindrical algebraic decomposition.
+ * Sample points are obtained by isolating the roots of the projection and lifting over them, i.e. isolating the roots of p in y.
+ */
+struct CADInstance {
+	carl::Variable x;
+	carl::Variable y;
+	MPoly p;
+	MPoly q;
+	Poly projection;
+};
+
+/// Dense random bivariate polynomial of total degree n, monic in y, with integer coefficients in [-10,10].
+inline MPoly random_bivariate(std::mt19937& rand, carl::Variable x, carl::Variable y, std::size_t n) {
+	std::uniform_int_distribution<int> coeff(-10, 10);
+	std::vector<MPoly> xs(1, MPoly(1));
+	std::vector<MPoly> ys(1, MPoly(1));
+	for (std::size_t i = 1; i <= n; ++i) {
+		xs.push_back(xs.back() * x);
+		ys.push_back(ys.back() * y);
+	}
+	MPoly res;
+	for (std::size_t i = 0; i <= n; ++i) {
+		for (std::size_t j = 0; i + j <= n; ++j) {
+			// The polynomial is monic in y, hence it has degree n in y for every value of x.
+			if (j == n) continue;
+			res += mpq_class(coeff(rand)) * xs[i] * ys[j];
+		}
+	}
+	return res + ys[n];
+}
+
+/// CAD instance with two random bivariate polynomials of total degree n.
+inline CADInstance cad_projection(std::size_t n) {
+	carl::Variable x = carl::fresh_real_variable("x");
+	carl::Variable y = carl::fresh_real_variable("y");
+	std::mt19937 rand(42);
+	MPoly p = random_bivariate(rand, x, y, n);
+	MPoly q = random_bivariate(rand, x, y, n);
+	auto res = carl::resultant(carl::to_univariate_polynomial(p, y), carl::to_univariate_polynomial(q, y));
+	assert(res.is_constant());
+	return CADInstance{x, y, p, q, carl::to_univariate_polynomial(res.lcoeff())};
+}
+
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <carl-arith/numbers/numbers.h>
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Power.h>
+#include <carl-arith/core/VariablePool.h>
+
+#include <limits>
+
+using carl::SmallInteger;
+using carl::SmallRational;
+
+TEST(SmallNumbers, IntegerPromotion)
+{
+	const carl::sint max = std::numeric_limits<carl::sint>::max();
+	SmallInteger a(max);
+	EXPECT_TRUE(a.is_small());
+	// The minimum of sint is not stored inline.
+	EXPECT_FALSE(SmallInteger(std::numeric_limits<carl::sint>::min()).is_small());
+	EXPECT_EQ(SmallInteger(std::numeric_limits<carl::sint>::min()), SmallInteger(-max) - 1);
+
+	SmallInteger b = a + 1;
+	EXPECT_FALSE(b.is_small());
+	EXPECT_EQ(b.to_mpz(), mpz_class(static_cast<signed long>(max)) + 1);
+	EXPECT_TRUE(b > a);
+	EXPECT_TRUE(-b < -a);
+	// Results that fit again are demoted.
+	EXPECT_TRUE((b - 1).is_small());
+	EXPECT_EQ(b - 1, a);
+	SmallInteger c = a * a;
+	EXPECT_FALSE(c.is_small());
+	EXPECT_EQ(c / a, a);
+	EXPECT_TRUE((c / a).is_small());
+	EXPECT_EQ(carl::gcd(c, SmallInteger(max) * 6), a);
+	EXPECT_EQ(SmallInteger(mpz_class("123456789012345678901234567890")), carl::parse<SmallInteger>("123456789012345678901234567890"));
+	EXPECT_EQ(std::hash<SmallInteger>()(b - 1), std::hash<SmallInteger>()(a));
+}
+
+TEST(SmallNumbers, IntegerDivision)
+{
+	// quotient and remainder truncate like native integers, divide rounds down like mpz_class.
+	for (carl::sint n: {-7, 7}) {
+		for (carl::sint d: {-3, 3}) {
+			EXPECT_EQ(carl::quotient(SmallInteger(n), SmallInteger(d)), SmallInteger(n / d));
+			EXPECT_EQ(carl::remainder(SmallInteger(n), SmallInteger(d)), SmallInteger(n % d));
+			SmallInteger q, r;
+			carl::divide(SmallInteger(n), SmallInteger(d), q, r);
+			mpz_class mq, mr;
+			carl::divide(mpz_class(static_cast<signed long>(n)), mpz_class(static_cast<signed long>(d)), mq, mr);
+			EXPECT_EQ(q.to_mpz(), mq);
+			EXPECT_EQ(r.to_mpz(), mr);
+		}
+	}
+}
+
+TEST(SmallNumbers, RationalArithmetic)
+{
+	SmallRational half(1, 2);
+	SmallRational third(1, 3);
+	EXPECT_EQ(half + third, SmallRational(5, 6));
+	EXPECT_EQ(half - third, SmallRational(1, 6));
+	EXPECT_EQ(half * third, SmallRational(1, 6));
+	EXPECT_EQ(half / third, SmallRational(3, 2));
+	EXPECT_EQ(SmallRational(4, -6), SmallRational(-2, 3));
+	EXPECT_EQ(half + half, 1);
+	EXPECT_TRUE(carl::is_one(half + half));
+	EXPECT_TRUE(carl::is_zero(half - half));
+	EXPECT_EQ(carl::floor(SmallRational(-7, 2)), -4);
+	EXPECT_EQ(carl::ceil(SmallRational(-7, 2)), -3);
+	EXPECT_EQ(carl::round(SmallRational(-7, 2)), -3);
+	EXPECT_EQ(carl::round(SmallRational(7, 2)), 4);
+	EXPECT_EQ(carl::to_double(SmallRational(3, 4)), 0.75);
+	EXPECT_EQ(carl::toString(SmallRational(-3, 4)), carl::toString(mpq_class(-3, 4)));
+
+	// Compare against mpq_class across the promotion boundary.
+	const carl::sint max = std::numeric_limits<carl::sint>::max();
+	SmallRational big(SmallInteger(max), SmallInteger(max - 1));
+	mpq_class mbig = big.to_mpq();
+	EXPECT_TRUE(big.is_small());
+	SmallRational sq = big * big;
+	EXPECT_FALSE(sq.is_small());
+	EXPECT_EQ(sq.to_mpq(), mbig * mbig);
+	SmallRational sum = big + SmallRational(1, 3);
+	EXPECT_EQ(sum.to_mpq(), mbig + mpq_class(1, 3));
+	EXPECT_EQ(sq / big, big);
+	EXPECT_TRUE((sq / big).is_small());
+	EXPECT_TRUE(sq > big);
+	EXPECT_TRUE(SmallRational(1, 3) < SmallRational(SmallInteger(max / 3 + 1), SmallInteger(max)));
+	EXPECT_EQ((carl::convert<mpq_class, SmallRational>(mbig * mbig)), sq);
+	EXPECT_EQ(std::hash<SmallRational>()(sq / big), std::hash<SmallRational>()(big));
+	EXPECT_EQ(carl::parse<SmallRational>("0.25/0.125"), 2);
+}
+
+TEST(SmallNumbers, PolynomialCoefficients)
+{
+	using Poly = carl::MultivariatePolynomial<SmallRational>;
+	carl::Variable x = carl::fresh_real_variable("x");
+	carl::Variable y = carl::fresh_real_variable("y");
+	Poly p = Poly(x) * SmallRational(1, 2) + Poly(y) * SmallRational(3, 4) - SmallRational(2);
+	Poly q = p * p;
+	EXPECT_EQ(q.total_degree(), 2);
+	EXPECT_EQ(q.constant_part(), 4);
+	EXPECT_EQ(q - p * p, Poly(0));
+	// Coefficients beyond machine words are promoted transparently.
+	Poly r = carl::pow(p * SmallRational(std::numeric_limits<carl::sint>::max()), 3);
+	EXPECT_FALSE(r.constant_part().is_small());
+	EXPECT_EQ(r / carl::pow(SmallRational(std::numeric_limits<carl::sint>::max()), 3), p * p * p);
+}
@@ -0,0 +1,53 @@
+#include "gtest/gtest.h"
+#include <carl-arith/poly/umvpoly/Geobucket.h>
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(Geobucket, Empty)
+{
+	Geobucket<MultivariatePolynomial<Rational>> g;
+	EXPECT_TRUE(g.empty());
+	EXPECT_TRUE(carl::is_zero(g.to_polynomial()));
+}
+
+TEST(Geobucket, Sum)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	MultivariatePolynomial<Rational> p({Rational(2)*x*x, Rational(-3)*x*y, Term<Rational>(y), Term<Rational>(Rational(1))});
+	MultivariatePolynomial<Rational> q({Rational(1)*x*y*y, Rational(3)*x*y, Term<Rational>(x)});
+
+	Geobucket<MultivariatePolynomial<Rational>> g;
+	MultivariatePolynomial<Rational> sum;
+	for (int i = 1; i < 50; ++i) {
+		Term<Rational> factor = Rational(i) * x;
+		g.add(factor, p);
+		g.add(-factor, q);
+		g.add(Term<Rational>(Rational(1)), p, 1);
+		sum += factor * p - factor * q + p - p.lterm();
+	}
+	EXPECT_FALSE(g.empty());
+	EXPECT_EQ(sum.lterm(), g.lterm());
+	EXPECT_EQ(sum, g.to_polynomial());
+	EXPECT_TRUE(g.empty());
+}
+
+TEST(Geobucket, Cancellation)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	MultivariatePolynomial<Rational> p({Rational(2)*x*x, Rational(-3)*x*y, Term<Rational>(y)});
+
+	Geobucket<MultivariatePolynomial<Rational>> g(p);
+	g.add(Term<Rational>(Rational(-1)), p);
+	EXPECT_TRUE(g.empty());
+
+	g.add(p);
+	g.add(Term<Rational>(Rational(-1)), p, 1);
+	EXPECT_EQ(p.lterm(), g.lterm());
+	g.strip_lterm();
+	EXPECT_TRUE(g.empty());
+}
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Evaluation.h>
+#include <carl-arith/poly/umvpoly/functions/horner/MultivariateHorner.h>
+#include <carl-arith/poly/umvpoly/functions/horner/HornerTape.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(HornerTape, Evaluation)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly p = Poly(x) * Poly(x) * Poly(y) * Rational(3) + Poly(x) * Poly(z) * Rational(1, 2) - Poly(y) * Poly(z) * Poly(z) + Rational(7);
+	MultivariateHorner<Poly, strategy> horner(p);
+	HornerTape tape(horner);
+	EXPECT_EQ(tape.variables().size(), 3);
+
+	std::map<Variable, Interval<double>> map;
+	map[x] = Interval<double>(-2, 1);
+	map[y] = Interval<double>(0, 3);
+	map[z] = Interval<double>(1, 2);
+	IntervalBox box(map);
+	EXPECT_EQ(tape.evaluate(box), carl::evaluate(horner, map));
+
+	std::vector<double> point;
+	std::map<Variable, Rational> assignment;
+	for (auto v: tape.variables()) {
+		double val = v == x ? -1.5 : (v == y ? 2.0 : 0.25);
+		point.push_back(val);
+		assignment.emplace(v, carl::rationalize<Rational>(val));
+	}
+	EXPECT_EQ(tape.evaluate(point), carl::to_double(carl::evaluate(p, assignment)));
+}
+
+TEST(HornerTape, Batch)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = Poly(x) * Poly(x) * Poly(x) - Poly(x) * Poly(y) * Rational(2) + Poly(y);
+	MultivariateHorner<Poly, strategy> horner(p);
+	HornerTape tape(horner);
+
+	std::vector<IntervalBox> boxes;
+	std::vector<std::map<Variable, Interval<double>>> maps;
+	for (int i = 0; i < 5; ++i) {
+		std::map<Variable, Interval<double>> map;
+		map[x] = Interval<double>(i - 3, i - 2);
+		map[y] = Interval<double>(-i, i);
+		maps.push_back(map);
+		boxes.emplace_back(map);
+	}
+	auto res = tape.evaluate_batch(boxes);
+	ASSERT_EQ(res.size(), boxes.size());
+	for (std::size_t i = 0; i < res.size(); ++i) {
+		EXPECT_EQ(res[i], carl::evaluate(horner, maps[i]));
+	}
+
+	// Constant polynomials compile to a single constant.
+	HornerTape constant(MultivariateHorner<Poly, strategy>(Poly(Rational(5))));
+	EXPECT_EQ(constant.registers(), 1);
+	EXPECT_EQ(constant.evaluate(std::vector<double>()), 5);
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Division.h>
 #include <carl-arith/poly/umvpoly/functions/Quotient.h>
 #include <carl-arith/poly/umvpoly/functions/SPolynomial.h>
 #include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
@@ -67,6 +68,22 @@ TEST(MultivariatePolynomial, remainder)
     EXPECT_TRUE( carl::is_zero(carl::remainder(p4, p)) );
 }
 
+TEST(MultivariatePolynomial, Division)
+{
+	Variable x = carl::fresh_real_variable("x");
+	Variable y = carl::fresh_real_variable("y");
+	MultivariatePolynomial<Rational> px( x );
+	MultivariatePolynomial<Rational> py( y );
+	MultivariatePolynomial<Rational> p( px*py - Rational(3)*py + Rational(1) );
+	MultivariatePolynomial<Rational> q( px*px*py + py*py - Rational(2)*px + Rational(1) );
+	MultivariatePolynomial<Rational> r( py - Rational(5) );
+	auto res = carl::divide(q * p + r, p);
+	EXPECT_EQ( q * p + r, res.quotient * p + res.remainder );
+	EXPECT_EQ( q, res.quotient );
+	EXPECT_EQ( r, res.remainder );
+	EXPECT_EQ( r, carl::remainder(q * p + r, p) );
+}
+
 
 
 TEST(MultivariatePolynomial, to_univariate_polynomial)
@@ -42,3 +42,71 @@ TEST(Resultant, det)
     //EXPECT_EQ(r3, r1);
     //EXPECT_EQ(r3, r2);
 }
+
+TEST(Resultant, Interpolation)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	using UPoly = UnivariatePolynomial<Poly>;
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly py(y);
+	Poly pz(z);
+
+	std::vector<UPoly> polys = {
+		UPoly(x, {py*py - Rational(2), Poly(Rational(0)), Poly(Rational(1))}),
+		UPoly(x, {pz, py, Poly(Rational(1))}),
+		UPoly(x, {py*pz - Rational(1), -pz*pz, py + Rational(3), Poly(Rational(2))}),
+		UPoly(x, {py, pz*pz, py*py*pz}),
+		UPoly(x, {Poly(Rational(-1)), Poly(Rational(0)), Poly(Rational(0)), py - pz}),
+		UPoly(x, {py*py*py, Poly(Rational(0)), py * Rational(-3), Poly(Rational(1))})
+	};
+	for (const auto& p: polys) {
+		for (const auto& q: polys) {
+			EXPECT_EQ(carl::resultant(p, q), carl::resultant(p, q, SubresultantStrategy::Interpolation)) << p << ", " << q;
+		}
+		EXPECT_EQ(carl::discriminant(p), carl::discriminant(p, SubresultantStrategy::Interpolation)) << p;
+	}
+}
+
+TEST(Resultant, ProjectionCache)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	using UPoly = UnivariatePolynomial<Poly>;
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly py(y);
+
+	std::vector<UPoly> polys = {
+		UPoly(x, {py*py - Rational(2), Poly(Rational(0)), Poly(Rational(1))}),
+		UPoly(x, {py, Poly(Rational(1)), Poly(Rational(1))}),
+		UPoly(x, {py + Rational(1), py * Rational(-2), Poly(Rational(3)), py}),
+		UPoly(x, {Poly(Rational(-1)), py, Poly(Rational(0)), Poly(Rational(1))}),
+		UPoly(x, {py, Poly(Rational(2))})
+	};
+	ProjectionCache<Poly> cache(100);
+	for (const auto& p: polys) {
+		for (const auto& q: polys) {
+			EXPECT_EQ(carl::resultant(p, q), cache.resultant(p, q)) << p << ", " << q;
+			EXPECT_EQ(carl::principalSubresultantsCoefficients(p, q), cache.principalSubresultantsCoefficients(p, q));
+		}
+		EXPECT_EQ(carl::discriminant(p), cache.discriminant(p));
+		EXPECT_EQ(carl::discriminant(p), cache.discriminant(p));
+	}
+	// Resultants are shared between both orders, discriminants are computed once.
+	EXPECT_EQ(cache.misses(), std::size_t(15 + 25 + 5));
+	EXPECT_EQ(cache.hits(), std::size_t(10 + 5));
+
+	ProjectionCache<Poly> small(2);
+	for (const auto& p: polys) small.discriminant(p);
+	EXPECT_EQ(small.size(), std::size_t(2));
+
+	ProjectionCache<Poly> global;
+	EXPECT_EQ(ProjectionCache<Poly>::set_global(&global), nullptr);
+	carl::discriminant(polys[0]);
+	carl::discriminant(polys[0]);
+	EXPECT_EQ(global.hits(), std::size_t(1));
+	EXPECT_EQ(ProjectionCache<Poly>::set_global(nullptr), &global);
+	carl::discriminant(polys[0]);
+	EXPECT_EQ(global.hits(), std::size_t(1));
+}
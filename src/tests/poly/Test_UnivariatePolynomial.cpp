@@ -8,6 +8,7 @@
 #include <carl-arith/poly/umvpoly/functions/Factorization_univariate.h>
 #include <carl-arith/poly/umvpoly/functions/Derivative.h>
 #include <carl-arith/poly/umvpoly/functions/Representation.h>
+#include <carl-arith/poly/umvpoly/functions/RootCounting.h>
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
 #include <carl-arith/core/VariablePool.h>
 
@@ -269,6 +270,83 @@ TEST(UnivariatePolynomial, factorization)
     EXPECT_EQ(pol6, productOfFactors);
 }
 
+TEST(UnivariatePolynomial, irreducibleFactorization)
+{
+	Variable x = fresh_real_variable("x");
+	using Poly = UnivariatePolynomial<Rational>;
+	// Swinnerton-Dyer polynomial for 2, 3, 5: irreducible, but splits into factors of degree at most two modulo every prime.
+	Poly sd(x, {576, 0, -960, 0, 352, 0, -40, 0, 1});
+	Poly cyc(x, {1, 0, 0, 0, 1});
+	Poly cub(x, {7, -1, 0, 3});
+	Poly lin(x, {Rational(-1, 2), 1});
+	Poly quad(x, {-2, 0, 1});
+	std::vector<std::pair<Poly, FactorMap<Rational>>> instances = {
+		{sd, {{sd, 1}}},
+		{sd * quad, {{sd, 1}, {quad, 1}}},
+		{cyc * cub * quad * lin * lin * Rational(6), {{cyc, 1}, {cub, 1}, {quad, 1}, {Poly(x, {-1, 2}), 2}, {Poly(x, Rational(3, 2)), 1}}},
+		{Rational(-1) * sd * cub * cub * cub * Poly(x, {0, 1}), {{sd, 1}, {cub, 3}, {Poly(x, {0, 1}), 1}, {Poly(x, Rational(-1)), 1}}},
+	};
+	for (const auto& [p, expected]: instances) {
+		EXPECT_EQ(expected, carl::factorization(p));
+		EXPECT_EQ(expected, carl::factorization(p, true));
+	}
+}
+
+TEST(UnivariatePolynomial, SturmSequenceCache)
+{
+	Variable x = fresh_real_variable("x");
+	using Poly = UnivariatePolynomial<Rational>;
+	// (x^2 - 2) * (x - 1/3) * (3x + 7): roots -7/3, -sqrt(2), 1/3, sqrt(2)
+	Poly p = Poly(x, {-2, 0, 1}) * Poly(x, {Rational(-1, 3), 1}) * Poly(x, {7, 3});
+	auto seq = carl::sturm_sequence(p);
+	std::vector<Rational> points = {Rational(-5), Rational(-2), Rational(-7, 5), Rational(0), Rational(1, 2), Rational(3, 2), Rational(10)};
+	auto variations = carl::sign_variations_at(seq, points);
+	ASSERT_EQ(variations.size(), points.size());
+	for (std::size_t k = 0; k < points.size(); ++k) {
+		EXPECT_EQ(variations[k], carl::sign_variations(seq.begin(), seq.end(), [&](const auto& q){ return carl::sgn(carl::evaluate(q, points[k])); }));
+	}
+	EXPECT_EQ(carl::count_real_roots(seq, Interval<Rational>(Rational(-5), Rational(10))), 4);
+	EXPECT_EQ(carl::count_real_roots(seq, Interval<Rational>(Rational(-2), Rational(1, 2))), 2);
+
+	SturmSequenceCache<Rational> cache;
+	EXPECT_EQ(SturmSequenceCache<Rational>::set_global(&cache), nullptr);
+	EXPECT_EQ(carl::count_real_roots(p, Interval<Rational>(Rational(-5), Rational(10))), 4);
+	EXPECT_EQ(carl::count_real_roots(p, Interval<Rational>(Rational(0), Rational(3, 2))), 2);
+	EXPECT_EQ(*carl::cached_sturm_sequence(p), seq);
+	EXPECT_EQ(cache.misses(), std::size_t(1));
+	EXPECT_EQ(cache.hits(), std::size_t(2));
+	EXPECT_EQ(SturmSequenceCache<Rational>::set_global(nullptr), &cache);
+
+	// The capacity bounds the total number of coefficients.
+	std::size_t size = cache.size();
+	cache.set_capacity(size + 3);
+	cache.get(Poly(x, {-2, 0, 1}));
+	EXPECT_EQ(cache.entries(), std::size_t(1));
+	EXPECT_LE(cache.size(), size + 3);
+}
+
+TEST(UnivariatePolynomial, SturmSequenceNegativeConstant)
+{
+	Variable x = fresh_real_variable("x");
+	using Poly = UnivariatePolynomial<Rational>;
+	// Both Sturm sequences end in a negative constant.
+	Poly p = Poly(x, {1, 0, 1});
+	Poly q = Poly(x, {2, 0, -1});
+	std::vector<Rational> points = {Rational(-2), Rational(-1, 3), Rational(0), Rational(2)};
+	for (const auto& poly: {p, q}) {
+		auto seq = carl::sturm_sequence(poly);
+		ASSERT_TRUE(carl::is_constant(seq.back()));
+		EXPECT_LT(seq.back().lcoeff(), 0);
+		auto variations = carl::sign_variations_at(seq, points);
+		for (std::size_t k = 0; k < points.size(); ++k) {
+			EXPECT_EQ(variations[k], carl::sign_variations(seq.begin(), seq.end(), [&](const auto& s){ return carl::sgn(carl::evaluate(s, points[k])); }));
+		}
+	}
+	EXPECT_EQ(carl::count_real_roots(carl::sturm_sequence(p), Interval<Rational>(Rational(-2), Rational(2))), 0);
+	EXPECT_EQ(carl::count_real_roots(carl::sturm_sequence(q), Interval<Rational>(Rational(0), Rational(2))), 1);
+	EXPECT_EQ(carl::count_real_roots(carl::sturm_sequence(q), Interval<Rational>(Rational(-2), Rational(2))), 2);
+}
+
 TEST(UnivariatePolynomial, isNumber)
 {
 	Variable x = fresh_real_variable("x");
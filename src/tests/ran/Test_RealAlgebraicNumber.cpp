@@ -102,3 +102,95 @@ TEST(RealAlgebraicNumber, EvalBug2)
 
 
 
+
+TEST(RealAlgebraicNumber, FilteredComparison)
+{
+	Variable x = fresh_real_variable("x");
+	UnivariatePolynomial<Rational> sqr2(x, {Rational(-2), Rational(0), Rational(1)});
+	Interval<Rational> onetwo(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+
+	ran::interval::Enclosure e(onetwo);
+	e.tighten(sqr2, onetwo, Sign::NEGATIVE);
+	EXPECT_TRUE(e.lower() <= std::sqrt(2.0) && std::sqrt(2.0) <= e.upper());
+	EXPECT_LT(e.upper() - e.lower(), 1e-14);
+
+	RealAlgebraicNumber<Rational> sqrt2(sqr2, onetwo);
+	RealAlgebraicNumber<Rational> cbrt3(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(0), Rational(1)}), onetwo);
+	// (x^2-2)*(x^2+2) has the same root in (1,2), but a different representation.
+	RealAlgebraicNumber<Rational> sqrt2b(UnivariatePolynomial<Rational>(x, {Rational(-4), Rational(0), Rational(0), Rational(0), Rational(1)}), onetwo);
+	EXPECT_TRUE(sqrt2 < cbrt3);
+	EXPECT_TRUE(cbrt3 > sqrt2);
+	EXPECT_TRUE(sqrt2 == sqrt2b);
+	EXPECT_TRUE(sqrt2b <= sqrt2);
+	// Rationals within the isolating interval, also closer than double precision.
+	EXPECT_TRUE(sqrt2 > Rational(7, 5));
+	EXPECT_TRUE(sqrt2 < Rational(3, 2));
+	EXPECT_TRUE(sqrt2 > Rational("14142135623730950488/10000000000000000000"));
+	EXPECT_TRUE(sqrt2 < Rational("14142135623730950489/10000000000000000000"));
+	EXPECT_TRUE(cbrt3 != Rational(36, 25));
+	EXPECT_TRUE(cbrt3 > Rational(36, 25));
+}
+
+TEST(RealAlgebraicNumber, RefineToPrecision)
+{
+	Variable x = fresh_real_variable("x");
+	RealAlgebraicNumber<Rational> sqrt2(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	sqrt2.refine_to_precision(300);
+	ASSERT_FALSE(sqrt2.is_numeric());
+	EXPECT_LE(sqrt2.interval().diameter(), Rational(1) / carl::pow(Rational(2), 300));
+	EXPECT_LT(sqrt2.interval().lower() * sqrt2.interval().lower(), Rational(2));
+	EXPECT_GT(sqrt2.interval().upper() * sqrt2.interval().upper(), Rational(2));
+
+	// Rational roots may be hit exactly.
+	UnivariatePolynomial<Rational> p = UnivariatePolynomial<Rational>(x, {Rational(-1,2), Rational(1)}) * UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)});
+	RealAlgebraicNumber<Rational> half(p, Interval<Rational>(Rational(1,4), BoundType::STRICT, Rational(1), BoundType::STRICT));
+	half.refine_to_precision(100);
+	EXPECT_TRUE(half == Rational(1,2));
+}
+
+TEST(RealAlgebraicNumber, EvaluationContext)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	using Poly = MultivariatePolynomial<Rational>;
+	Interval<Rational> onetwo(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+	RealAlgebraicNumber<Rational> sqrt2(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), onetwo);
+	RealAlgebraicNumber<Rational> sqrt3(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), onetwo);
+
+	ran::interval::EvaluationContext<Rational> ctx;
+	ctx.assign(x, sqrt2);
+	ctx.assign(y, sqrt3);
+	// x*y - sqrt(6) is zero, which is decided by root bounds.
+	Poly p = Poly(x) * Poly(y) * Poly(x) * Poly(y) - Rational(6);
+	Poly q = Poly(x) * Poly(x) * Poly(y) - Rational(2) * Poly(y);
+	Poly r = Poly(x) * Poly(y) - Rational(2);
+	EXPECT_EQ(ctx.sgn(p), Sign::ZERO);
+	EXPECT_EQ(ctx.sgn(q), Sign::ZERO);
+	EXPECT_EQ(ctx.sgn(r), Sign::POSITIVE);
+	EXPECT_EQ(ctx.sgn(-r), Sign::NEGATIVE);
+	EXPECT_EQ(ctx.misses(), 4);
+	// Positive multiples share their cache entry.
+	EXPECT_EQ(ctx.sgn(Rational(3) * r), Sign::POSITIVE);
+	EXPECT_TRUE(ctx.evaluate(BasicConstraint<Poly>(r, Relation::GREATER)));
+	EXPECT_FALSE(ctx.evaluate(BasicConstraint<Poly>(q, Relation::NEQ)));
+	EXPECT_EQ(ctx.misses(), 4);
+	EXPECT_EQ(ctx.hits(), 3);
+	// Results agree with the evaluation without context.
+	EXPECT_EQ(ctx.evaluate(BasicConstraint<Poly>(r, Relation::LESS)), carl::evaluate(BasicConstraint<Poly>(r, Relation::LESS), ctx.assignment()));
+
+	// Unassigned variables are reported, extending the assignment keeps the cached results.
+	Poly s = Poly(z) - Poly(x);
+	EXPECT_FALSE(ctx.sgn(s));
+	ctx.assign(z, sqrt3);
+	EXPECT_EQ(ctx.sgn(s), Sign::POSITIVE);
+	EXPECT_EQ(ctx.sgn(r), Sign::POSITIVE);
+	EXPECT_EQ(ctx.hits(), 5);
+	// Reassigning a variable invalidates the results that depend on it.
+	ctx.assign(y, RealAlgebraicNumber<Rational>(Rational(1)));
+	EXPECT_EQ(ctx.sgn(r), Sign::NEGATIVE);
+	EXPECT_EQ(ctx.sgn(s), Sign::POSITIVE);
+	EXPECT_EQ(ctx.hits(), 6);
+	ctx.unassign(z);
+	EXPECT_FALSE(ctx.sgn(s));
+}
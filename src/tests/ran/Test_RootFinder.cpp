@@ -125,4 +125,79 @@ TEST(RootFinder, Comparison)
 	auto ran1 = carl::real_roots(p, carl::Interval<mpq_class>::unbounded_interval()).roots();
 
 	std::cout << ran1 << std::endl;
-}
\ No newline at end of file
+}
+
+TEST(RootFinder, IsolationStrategies)
+{
+	carl::Variable x = carl::fresh_real_variable("x");
+	carl::Chebyshev<Rational> chebyshev(x);
+	// Linear factors x - r, their products have rational roots that are hit by bisection.
+	auto linear = [&x](Rational r) { return UPolynomial(x, {-r, Rational(1)}); };
+	std::vector<UPolynomial> polys = {
+		chebyshev(20),
+		chebyshev(21),
+		linear(Rational(1,2)) * linear(Rational(-3,4)) * linear(Rational(5)) * UPolynomial(x, {Rational(-2), Rational(0), Rational(1)}) * UPolynomial(x, {Rational(-3), Rational(0), Rational(0), Rational(1)}),
+		linear(1) * linear(2) * linear(3) * linear(4) * linear(5) * linear(6) * linear(7),
+		UPolynomial(x, {Rational(1), Rational(0), Rational(1), Rational(0), Rational(1)}),
+		// Mignotte-like polynomial with two close roots
+		UPolynomial(x, {Rational(-1), Rational(200), Rational(-10000), Rational(0), Rational(0), Rational(0), Rational(0), Rational(1)}),
+		UPolynomial(x, {Rational(3,7), Rational(-1,2), Rational(0), Rational(1,5), Rational(2), Rational(-1,3)}),
+	};
+	std::vector<Interval<Rational>> intervals = {
+		Interval<Rational>::unbounded_interval(),
+		Interval<Rational>(Rational(-1,2), BoundType::WEAK, Rational(2), BoundType::WEAK),
+		Interval<Rational>(Rational(1,2), BoundType::STRICT, Rational(5), BoundType::STRICT),
+		Interval<Rational>(Rational(0), BoundType::WEAK, Rational(0), BoundType::INFTY),
+	};
+	for (const auto& p: polys) {
+		for (const auto& i: intervals) {
+			auto expected = real_roots(p, i).roots();
+			for (auto strategy: {carl::ran::RootIsolationStrategy::Descartes, carl::ran::RootIsolationStrategy::ContinuedFraction, carl::ran::RootIsolationStrategy::Approximation}) {
+				auto roots = real_roots(p, i, strategy).roots();
+				ASSERT_EQ(expected.size(), roots.size()) << p << " within " << i;
+				for (std::size_t k = 0; k < roots.size(); ++k) {
+					EXPECT_EQ(expected[k], roots[k]) << p << " within " << i;
+				}
+			}
+		}
+	}
+}
+
+TEST(RootFinder, Batch)
+{
+	carl::Variable x = carl::fresh_real_variable("x");
+	carl::Variable y = carl::fresh_real_variable("y");
+	carl::Variable z = carl::fresh_real_variable("z");
+	carl::Variable w = carl::fresh_real_variable("w");
+	std::map<carl::Variable, carl::RealAlgebraicNumberInterval<Rational>> assignment = {
+		{y, carl::RealAlgebraicNumberInterval<Rational>(Rational(1,2))},
+		{z, carl::RealAlgebraicNumberInterval<Rational>(Rational(2))},
+	};
+	auto linear = [&x](const MPolynomial& r) { return UMPolynomial(x, {-r, MPolynomial(1)}); };
+	std::vector<UMPolynomial> polys = {
+		linear(MPolynomial(y)) * linear(MPolynomial(y)) * linear(MPolynomial(z)),
+		UMPolynomial(x, {MPolynomial(0), MPolynomial(y) - Rational(1,2)}),
+		linear(MPolynomial(y)),
+		linear(MPolynomial(w)),
+		UMPolynomial(x, {MPolynomial(-2), MPolynomial(0), MPolynomial(1)}),
+	};
+	std::vector<bool> modes = {false};
+#ifdef THREAD_SAFE
+	modes.push_back(true);
+#endif
+	for (bool parallel: modes) {
+		auto res = carl::real_roots(polys, assignment, carl::Interval<Rational>::unbounded_interval(), carl::ran::RootIsolationStrategy::Bisection, parallel);
+		EXPECT_EQ(std::vector<std::size_t>({1}), res.nullified);
+		EXPECT_EQ(std::vector<std::size_t>({3}), res.non_univariate);
+		ASSERT_EQ(4, res.roots.size());
+		using Sources = std::vector<std::pair<std::size_t,std::size_t>>;
+		EXPECT_TRUE(res.roots[0].value < Rational(-1));
+		EXPECT_EQ(Sources({{4, 1}}), res.roots[0].sources);
+		EXPECT_EQ(Rational(1,2), res.roots[1].value);
+		EXPECT_EQ(Sources({{0, 2}, {2, 1}}), res.roots[1].sources);
+		EXPECT_TRUE(res.roots[2].value > Rational(1) && res.roots[2].value < Rational(2));
+		EXPECT_EQ(Sources({{4, 1}}), res.roots[2].sources);
+		EXPECT_EQ(Rational(2), res.roots[3].value);
+		EXPECT_EQ(Sources({{0, 1}}), res.roots[3].sources);
+	}
+}
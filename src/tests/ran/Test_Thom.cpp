@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/ran/thom/ran_thom.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(Thom, RootFinding)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	auto& cache = TarskiQueryCache<Rational>::getInstance();
+	cache.clear();
+
+	// x^3 - 2x has the roots -sqrt(2) < 0 < sqrt(2)
+	Poly p = Poly(x) * x * x - Rational(2) * Poly(x);
+	auto roots = realRootsThom(p, x);
+	ASSERT_EQ(roots.size(), 3u);
+	std::vector<ThomEncoding<Rational>> sorted(roots.begin(), roots.end());
+	std::sort(sorted.begin(), sorted.end());
+	EXPECT_EQ(sorted[0].sgnReprNum(), Sign::NEGATIVE);
+	EXPECT_EQ(sorted[1].sgnReprNum(), Sign::ZERO);
+	EXPECT_EQ(sorted[2].sgnReprNum(), Sign::POSITIVE);
+	EXPECT_TRUE(sorted[2] > Rational(7, 5));
+	EXPECT_TRUE(sorted[2] < Rational(3, 2));
+	// sqrt(2)^2 - 2 = 0 and sqrt(2) - 1 > 0
+	EXPECT_EQ(sorted[2].sgn(Poly(x) * x - Rational(2)), Sign::ZERO);
+	EXPECT_EQ(sorted[2].sgn(Poly(x) - Rational(1)), Sign::POSITIVE);
+
+	// The zero set of p is set up only once, all further queries share it.
+	std::size_t misses = cache.misses();
+	EXPECT_EQ(realRootsThom(Rational(3) * p, x).size(), 3u);
+	EXPECT_EQ(cache.misses(), misses);
+	EXPECT_GT(cache.hits(), 0u);
+
+	// Lifting over sqrt(2): y^2 - x has the roots -2^(1/4) and 2^(1/4), which uses the multiplication table of {p, y^2 - x}.
+	std::map<Variable, ThomEncoding<Rational>> m = {{x, sorted[2]}};
+	auto lifted = realRootsThom(Poly(y) * y - Poly(x), y, m);
+	ASSERT_EQ(lifted.size(), 2u);
+	for (const auto& r: lifted) {
+		// (2^(1/4))^4 = 2
+		EXPECT_EQ(r.sgn(Poly(y) * y * y * y - Rational(2)), Sign::ZERO);
+		EXPECT_EQ(r.sgn(Poly(y) * y - Rational(1)), Sign::POSITIVE);
+	}
+	EXPECT_NE(lifted.front().sgn(Poly(y)), lifted.back().sgn(Poly(y)));
+}